@@ -0,0 +1,643 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * arinc429_bench.c: Cost per call of the stages of arinc429_tick_task()
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/* Usage: arinc429_bench [seconds per scenario]
+ *
+ * After the set-up of a scenario, the main loop is run with the body of
+ * arinc429_tick_task() unrolled, so that each stage can be timed on its own.
+ * Two costs are reported per call:
+ *
+ * - host: CPU time and TSC cycles on the PC, including the time spent in the
+ *         HI-3593 model. Only useful to compare stages and scenarios.
+ * - SPI:  simulated time on the SPI bus at HI3593_SPI_BAUDRATE. On the
+ *         Bricklet this is the time the task is blocked in the SPI transfers,
+ *         and it dominates the cost of the RX and TX stages.
+ *
+ * The per-channel figures show whether a budget is too small: RX FIFO words
+ * overwritten by the chip mean that ARINC429_RX_FRAME_BUDGET does not keep up,
+ * timeout checks lagging behind the deadlines by more than a few ms mean that the
+ * same holds for ARINC429_TIMEOUT_CHECK_BUDGET. When the RX FIFOs are polled,
+ * the frame budget grows up to ARINC429_RX_FRAME_BUDGET_MAX. A TX1 rate below
+ * the line rate in tx_stream means that ARINC429_TX_BURST_SIZE or ARINC429_TX_QUEUE_SIZE
+ * is too small.
+ * All budgets can be set at configure time:
+ *
+ *   cmake -S . -B build -DARINC429_RX_FRAME_BUDGET=8 -DARINC429_TIMEOUT_CHECK_BUDGET=20
+ */
+
+#define _GNU_SOURCE
+
+#include "host_platform.h"
+#include "host_api.h"
+#include "hi3593_sim.h"
+
+#include "arinc429.h"
+#include "communication.h"
+
+#include "bricklib2/hal/system_timer/system_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CYCLES()  __rdtsc()
+#else
+#define BENCH_CYCLES()  0
+#endif
+
+// stages of arinc429_tick_task(), not exported by arinc429.h
+void arinc429_task_update_channel_config(void);
+void arinc429_task_tx_immediate(void);
+void arinc429_task_tx_scheduled(void);
+void arinc429_task_receive_frames(void);
+void arinc429_task_check_timeout(void);
+void generate_heartbeat_callback(void);
+
+#define BENCH_STAGES_NUM  6
+
+
+/****************************************************************************/
+/* data structures                                                          */
+/****************************************************************************/
+
+// one stage of the tick task
+typedef struct
+{
+	const char *name;
+	void      (*function)(void);
+
+	uint64_t    calls;                                      // number of calls
+	uint64_t    host_ns;                                    // CPU time on the host
+	uint64_t    host_ns_max;                                // max. CPU time of a single call
+	uint64_t    cycles;                                     // TSC cycles on the host
+	uint64_t    spi_transactions;                           // SPI transactions
+	uint64_t    spi_ns;                                     // simulated time on the SPI bus
+	uint64_t    spi_ns_max;                                 // max. simulated SPI time of a single call
+}
+BenchStage;
+
+
+// a scenario
+typedef struct
+{
+	const char *name;
+	const char *description;
+	void      (*setup)(void);
+}
+BenchScenario;
+
+
+static BenchStage bench_stage[BENCH_STAGES_NUM] =
+{
+	{"update_channel_config", arinc429_task_update_channel_config, 0, 0, 0, 0, 0, 0, 0},
+	{"tx_immediate",          arinc429_task_tx_immediate,          0, 0, 0, 0, 0, 0, 0},
+	{"tx_scheduled",          arinc429_task_tx_scheduled,          0, 0, 0, 0, 0, 0, 0},
+	{"receive_frames",        arinc429_task_receive_frames,        0, 0, 0, 0, 0, 0, 0},
+	{"check_timeout",         arinc429_task_check_timeout,         0, 0, 0, 0, 0, 0, 0},
+	{"heartbeat_callback",    generate_heartbeat_callback,         0, 0, 0, 0, 0, 0, 0},
+};
+
+static uint32_t bench_lru_frame[HI3593_SIM_RX_CHANNELS_NUM][256];
+
+static uint64_t bench_overhead_ns;                          // cost of the time measurement itself
+static uint64_t bench_overhead_cycles;
+
+static uint16_t bench_timeout_lag_max;                      // max. time a timeout check lagged behind its deadline [ms]
+
+static bool     bench_capture_drain;                        // the master reads out the capture ring once per ms
+static uint64_t bench_capture_next_ns;                      // time of the next read-out
+static uint32_t bench_capture_frames;                       // frames read out of the capture ring
+static uint32_t bench_capture_requests;                     // read_capture_low_level() requests needed for that
+
+static bool     bench_tx_stream;                            // the master keeps the immediate transmit queue filled
+static uint32_t bench_tx_frame;                             // next frame written by the master
+static uint8_t  bench_tx_credits;                           // frames the master may write without being refused
+static uint32_t bench_tx_requests;                          // write_frames_direct() requests
+static uint32_t bench_tx_refused;                           // frames not taken by the immediate transmit queue
+
+
+/****************************************************************************/
+/* scenarios                                                                */
+/****************************************************************************/
+
+/* common part: both directions at high speed, heartbeats every second */
+static void setup_common(void)
+{
+	// let the firmware initialize the chip
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_TX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+	api_set_channel_configuration(ARINC429_CHANNEL_RX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+
+	api_set_heartbeat_callback_configuration(ARINC429_CHANNEL_TX, true, false, 1000);
+	api_set_heartbeat_callback_configuration(ARINC429_CHANNEL_RX, true, false, 1000);
+}
+
+
+/* both receivers get all 256 labels at full line rate */
+static void setup_rx_sources(void)
+{
+	for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+	{
+		for(uint16_t j = 0; j < 256; j++)
+		{
+			bench_lru_frame[i][j] = ((uint32_t)(j + i) << 10) | j;
+		}
+
+		hi3593_sim_set_rx_source(i, bench_lru_frame[i], 256, ARINC429_SPEED_HS, HI3593_SIM_GAP_BITS_MIN);
+	}
+}
+
+
+/* both receivers get all 256 labels at full line rate, with a filter for each */
+static void setup_rx_traffic(void)
+{
+	// 256 filters per channel, i.e. all frame buffers in use
+	api_set_rx_standard_filters(ARINC429_CHANNEL_RX);
+	api_set_rx_callback_configuration(ARINC429_CHANNEL_RX, true, false, 1000);
+
+	setup_rx_sources();
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX, ARINC429_CHANNEL_MODE_ACTIVE);
+}
+
+
+static void setup_idle(void)
+{
+	setup_common();
+
+	// receivers active with all filters, but no traffic on the bus
+	api_set_rx_standard_filters(ARINC429_CHANNEL_RX);
+	api_set_rx_callback_configuration(ARINC429_CHANNEL_RX, true, false, 1000);
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_ACTIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_ACTIVE);
+}
+
+
+static void setup_rx_saturated(void)
+{
+	setup_common();
+	setup_rx_traffic();
+
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_ACTIVE);
+}
+
+
+static void setup_scheduler_1000(void)
+{
+	setup_common();
+
+	for(uint16_t i = 0; i < ARINC429_TX_BUFFER_NUM; i++)
+	{
+		api_write_frame_scheduled(ARINC429_CHANNEL_TX, i, ((uint32_t)i << 8) | (i & 0xFF));
+	}
+
+	// 1000 cyclic jobs, two frames per ms - below the high-speed line rate of ~2.7 frames per ms
+	for(uint16_t i = 0; i < ARINC429_TX_JOBS_NUM; i++)
+	{
+		api_set_schedule_entry(ARINC429_CHANNEL_TX, i, ARINC429_SCHEDULER_JOB_CYCLIC, i % ARINC429_TX_BUFFER_NUM, (i & 1) ? 1 : 0);
+	}
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_PASSIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_RUN    );
+}
+
+
+static void setup_scheduler_8(void)
+{
+	setup_common();
+
+	for(uint16_t i = 0; i < 8; i++)
+	{
+		api_write_frame_scheduled(ARINC429_CHANNEL_TX, i, ((uint32_t)i << 8) | (i & 0xFF));
+	}
+
+	// 8 cyclic jobs spread over the job table, one frame per ms - the rest of the table is unused
+	for(uint16_t i = 0; i < 8; i++)
+	{
+		api_set_schedule_entry(ARINC429_CHANNEL_TX, i * (ARINC429_TX_JOBS_NUM / 8), ARINC429_SCHEDULER_JOB_CYCLIC, i, 1);
+	}
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_PASSIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_RUN    );
+}
+
+
+static void setup_rx_slow_loop(void)
+{
+	setup_rx_saturated();
+
+	// the rest of the main loop takes 2 ms, i.e. the RX FIFOs fill up between two ticks
+	host_platform.loop_ns = 2000000;
+}
+
+
+static void setup_rx_polled(void)
+{
+	setup_rx_saturated();
+
+	// the rest of the main loop takes 4 ms, i.e. the RX FIFOs are close to overflow between two ticks
+	host_platform.loop_ns = 4000000;
+
+	// no RxINT interrupts, the receivers are polled within the frame budget
+	hi3593_sim_disconnect_rx_int(0, true);
+	hi3593_sim_disconnect_rx_int(1, true);
+}
+
+
+static void setup_rx_batched(void)
+{
+	setup_rx_saturated();
+
+	// up to 8 frames per callback message
+	api_set_rx_batch_configuration(ARINC429_CHANNEL_RX, true);
+}
+
+
+static void setup_rx_coalesced(void)
+{
+	setup_rx_batched();
+
+	// hold frames back for up to 5 ms to collect full batches
+	api_set_rx_batch_coalescing(ARINC429_CHANNEL_RX, ARINC429_CALLBACK_BATCH_SIZE, 5);
+}
+
+
+static void setup_rx_monitor(void)
+{
+	setup_common();
+	setup_rx_sources();
+
+	// no filters at all, every frame goes into the capture ring
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_MONITOR);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_ACTIVE );
+
+	// the master takes the captured frames as fast as they come in
+	bench_capture_drain = true;
+}
+
+
+#if ARINC429_RX_STATS_NUM > 0
+static void setup_rx_statistics(void)
+{
+	setup_rx_saturated();
+
+	// receive statistics on as many filters as possible
+	for(uint8_t i = 0; i < ARINC429_RX_STATS_NUM; i++)
+	{
+		api_set_rx_filter_statistics(ARINC429_CHANNEL_RX, i * 32, ARINC429_SDI_DATA, true);
+	}
+}
+#endif
+
+
+/* the master takes up the credits advertised by the TX queue credits callback */
+static void bench_message_handler(const uint8_t *data, const uint8_t length)
+{
+	if(((const TFPMessageHeader *)data)->fid == FID_CALLBACK_TX_CREDITS)
+	{
+		bench_tx_credits = ((const TXCredits_Callback *)data)->credits;
+	}
+}
+
+
+static void setup_tx_stream(void)
+{
+	setup_rx_slow_loop();
+
+	// the master writes as many frames as it holds credits for, and gets new ones when the queue is half empty
+	api_set_tx_credit_configuration(ARINC429_CHANNEL_TX1, true, ARINC429_TX_QUEUE_SIZE / 2);
+
+	host_platform.message_handler = bench_message_handler;
+
+	bench_tx_credits = ARINC429_TX_QUEUE_SIZE - 1;
+	bench_tx_stream  = true;
+}
+
+
+static void setup_callback_full(void)
+{
+	setup_rx_saturated();
+
+	// run until the callback queue is full, from then on every enqueue fails
+	host_platform.link_blocked = true;
+	host_firmware_run_ms(100);
+}
+
+
+static const BenchScenario bench_scenario[] =
+{
+	{"idle",           "RX active with 256 filters, TX active, no bus traffic",        setup_idle          },
+	{"rx_saturated",   "RX1 + RX2 at full high-speed line rate, 256 filters each",     setup_rx_saturated  },
+	{"rx_slow_loop",   "as rx_saturated, but with 2 ms per main loop pass",            setup_rx_slow_loop  },
+	{"rx_polled",      "as rx_saturated, but 4 ms per main loop pass and no RxINT",   setup_rx_polled     },
+	{"rx_batched",     "as rx_saturated, but with frame batch callbacks",              setup_rx_batched    },
+	{"rx_coalesced",   "as rx_batched, but holding frames back for up to 5 ms",        setup_rx_coalesced  },
+	{"rx_monitor",     "RX1 + RX2 at full high-speed line rate in monitor mode",       setup_rx_monitor    },
+#if ARINC429_RX_STATS_NUM > 0
+	{"rx_statistics",  "as rx_saturated, with all receive statistics in use",          setup_rx_statistics },
+#endif
+	{"scheduler_1000", "TX scheduler running 1000 cyclic jobs at 2 frames/ms",         setup_scheduler_1000},
+	{"scheduler_8",    "TX scheduler running 8 cyclic jobs in a sparse job table",      setup_scheduler_8   },
+	{"tx_stream",      "as rx_slow_loop, with TX1 fed nonstop by bulk direct writes",    setup_tx_stream     },
+	{"callback_full",  "as rx_saturated, but the master does not take any callbacks",  setup_callback_full },
+};
+
+
+/****************************************************************************/
+/* measurement                                                              */
+/****************************************************************************/
+
+static inline uint64_t bench_host_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+/* determine the cost of the time measurement, it is subtracted from the figures */
+static void bench_calibrate(void)
+{
+	const uint32_t runs   = 100000;
+	      uint64_t ns     = 0;
+	      uint64_t cycles = 0;
+
+	for(uint32_t i = 0; i < runs; i++)
+	{
+		const uint64_t start_cycles = BENCH_CYCLES();
+		const uint64_t start_ns     = bench_host_ns();
+
+		ns     += bench_host_ns() - start_ns;
+		cycles += BENCH_CYCLES()  - start_cycles;
+	}
+
+	bench_overhead_ns     = ns     / runs;
+	bench_overhead_cycles = cycles / runs;
+}
+
+
+/* call one stage and account for its cost */
+static void bench_call(BenchStage *stage)
+{
+	const uint32_t spi_transactions = hi3593_sim.spi_transactions;
+	const uint64_t spi_ns           = hi3593_sim.spi_time_ns;
+	const uint64_t cycles           = BENCH_CYCLES();
+	const uint64_t start            = bench_host_ns();
+
+	stage->function();
+
+	const uint64_t host_ns = bench_host_ns() - start;
+	const uint64_t spi     = hi3593_sim.spi_time_ns - spi_ns;
+
+	stage->cycles           += BENCH_CYCLES() - cycles;
+	stage->host_ns          += host_ns;
+	stage->spi_transactions += hi3593_sim.spi_transactions - spi_transactions;
+	stage->spi_ns           += spi;
+	stage->calls++;
+
+	if(host_ns > stage->host_ns_max)  stage->host_ns_max = host_ns;
+	if(spi     > stage->spi_ns_max )  stage->spi_ns_max  = spi;
+}
+
+
+/* clear all counters, but keep the state of the firmware and the chip */
+static void bench_reset_statistics(void)
+{
+	for(uint8_t i = 0; i < BENCH_STAGES_NUM; i++)
+	{
+		BenchStage *stage = &bench_stage[i];
+
+		stage->calls            = stage->host_ns = stage->host_ns_max = stage->cycles = 0;
+		stage->spi_transactions = stage->spi_ns  = stage->spi_ns_max  = 0;
+	}
+
+	bench_timeout_lag_max  = 0;
+	bench_capture_frames   = 0;
+	bench_capture_requests = 0;
+
+	arinc429.capture.frames_lost = 0;
+
+	for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+	{
+		HI3593SimRX *chip = &(hi3593_sim.rx[i]);
+
+		chip->words_on_bus      = chip->words_stored = chip->words_rejected  = 0;
+		chip->words_overwritten = chip->words_read   = chip->fifo_high_water = 0;
+
+		arinc429.rx_channel[i].common.frames_processed_curr = arinc429.rx_channel[i].common.frames_lost_curr = 0;
+	}
+
+	hi3593_sim.tx.words_written = hi3593_sim.tx.words_ignored = hi3593_sim.tx.words_transmitted = 0;
+
+	arinc429.tx_channel[0].common.frames_processed_curr = arinc429.tx_channel[0].common.frames_lost_curr = 0;
+
+	hi3593_sim.spi_transactions   = 0;
+	hi3593_sim.spi_bytes          = 0;
+	hi3593_sim.spi_time_ns        = 0;
+	host_platform.loop_iterations = 0;
+	host_platform.messages_sent   = 0;
+
+	memset(host_platform.messages_by_fid, 0, sizeof(host_platform.messages_by_fid));
+
+	bench_tx_requests = 0;
+	bench_tx_refused  = 0;
+}
+
+
+/* the main loop, with the body of arinc429_tick_task() unrolled */
+static void bench_run_ms(const uint32_t duration)
+{
+	const uint64_t end_ns = hi3593_sim.time_ns + (uint64_t)duration * 1000000;
+
+	while(hi3593_sim.time_ns < end_ns)
+	{
+		communication_tick();
+
+		// the master fills up the immediate transmit queue in bulk writes as long as it holds credits
+		while(bench_tx_stream && (bench_tx_credits > 0))
+		{
+			uint32_t frame[ARINC429_WRITE_CHUNK_SIZE];
+			uint8_t  frames_num = (bench_tx_credits < ARINC429_WRITE_CHUNK_SIZE) ? bench_tx_credits : ARINC429_WRITE_CHUNK_SIZE;
+			uint8_t  accepted;
+
+			for(uint8_t j = 0; j < frames_num; j++)  frame[j] = ((bench_tx_frame + j) << 8) | 0x0F;
+
+			if(!api_write_frames_direct(ARINC429_CHANNEL_TX1, frame, frames_num, &accepted, &bench_tx_credits))  break;
+
+			bench_tx_frame    += accepted;
+			bench_tx_refused  += frames_num - accepted;
+			bench_tx_requests++;
+		}
+
+		bench_call(&bench_stage[0]);  // arinc429_task_update_channel_config()
+		bench_call(&bench_stage[1]);  // arinc429_task_tx_immediate()
+		bench_call(&bench_stage[2]);  // arinc429_task_tx_scheduled()
+		bench_call(&bench_stage[3]);  // arinc429_task_receive_frames()
+		bench_call(&bench_stage[4]);  // arinc429_task_check_timeout()
+
+		// time by which the timeout checks are behind the deadlines of the frame buffer groups
+		for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+		{
+			const ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+			if(channel->common.operating_mode != ARINC429_CHANNEL_MODE_ACTIVE)  continue;
+
+			for(uint8_t k = 0; k < ARINC429_RX_BUFFER_NUM / 32; k++)
+			{
+				const uint16_t lag = (uint16_t)system_timer_get_ms() - channel->timeout_due[k];
+
+				if(channel->timeout_armed[k] && (lag < 0x8000) && (lag > bench_timeout_lag_max))  bench_timeout_lag_max = lag;
+			}
+		}
+
+		hi3593_tick();
+
+		bench_call(&bench_stage[5]);  // generate_heartbeat_callback()
+
+		// the master reads out the capture ring
+		if(bench_capture_drain && (hi3593_sim.time_ns >= bench_capture_next_ns))
+		{
+			static uint32_t frame    [ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+			static uint32_t timestamp[ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+			static uint8_t  channel  [ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+			       uint16_t frames_read;
+
+			bench_capture_next_ns = hi3593_sim.time_ns + 1000000;
+
+			if(api_read_capture(ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE, frame, timestamp, channel, &frames_read))
+			{
+				bench_capture_frames   += frames_read;
+				bench_capture_requests += (frames_read + ARINC429_CAPTURE_CHUNK_SIZE - 1) / ARINC429_CAPTURE_CHUNK_SIZE;
+			}
+		}
+
+		hi3593_sim_advance_ns(host_platform.loop_ns);
+
+		host_platform.loop_iterations++;
+	}
+}
+
+
+/****************************************************************************/
+/* report                                                                   */
+/****************************************************************************/
+
+static void report(const BenchScenario *scenario, const double seconds)
+{
+	printf("\n=== %s: %s\n\n", scenario->name, scenario->description);
+
+	printf("%-22s %12s %10s %10s %12s %10s %10s %10s\n",
+	       "stage", "calls", "host ns", "max ns", "host cycles", "SPI trans", "SPI us", "max us");
+
+	for(uint8_t i = 0; i < BENCH_STAGES_NUM; i++)
+	{
+		const BenchStage *stage  = &bench_stage[i];
+		const double      calls  = stage->calls ? (double)stage->calls : 1.0;
+		      double      ns     = stage->host_ns / calls - bench_overhead_ns;
+		      double      cycles = stage->cycles  / calls - bench_overhead_cycles;
+
+		if(ns     < 0)  ns     = 0;
+		if(cycles < 0)  cycles = 0;
+
+		printf("%-22s %12lu %10.0f %10lu %12.0f %10.2f %10.2f %10.1f\n",
+		       stage->name, stage->calls, ns, stage->host_ns_max, cycles,
+		       stage->spi_transactions / calls, stage->spi_ns / calls / 1000.0, stage->spi_ns_max / 1000.0);
+	}
+
+	printf("\nmain loop %.0f passes/s, SPI bus load %.1f %%, %u messages to the master\n",
+	       host_platform.loop_iterations / seconds, 100.0 * hi3593_sim.spi_time_ns / (seconds * 1e9), host_platform.messages_sent);
+
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		const HI3593SimRX       *chip    = &(hi3593_sim.rx[i]);
+		const ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+		printf("RX%u  bus %6.0f/s  read %6.0f/s  overwritten %6.0f/s  FIFO max %2u  processed %5u  lost %5u\n",
+		       i + 1, chip->words_on_bus / seconds, chip->words_read / seconds, chip->words_overwritten / seconds,
+		       chip->fifo_high_water, channel->common.frames_processed_curr, channel->common.frames_lost_curr);
+	}
+
+	printf("TX1  written %6.0f/s  transmitted %6.0f/s  processed %5u  lost %5u\n",
+	       hi3593_sim.tx.words_written / seconds, hi3593_sim.tx.words_transmitted / seconds,
+	       arinc429.tx_channel[0].common.frames_processed_curr, arinc429.tx_channel[0].common.frames_lost_curr);
+
+	// a timeout is detected at the latest this lag after its deadline
+	printf("timeout check lag max %u ms\n", bench_timeout_lag_max);
+
+	if(bench_tx_stream)
+	{
+		printf("TX1 queue fed with %6.0f requests/s, %6.0f credits callbacks/s, %u frames refused\n",
+		       bench_tx_requests / seconds, host_platform.messages_by_fid[FID_CALLBACK_TX_CREDITS] / seconds, bench_tx_refused);
+	}
+
+	if(bench_capture_drain)
+	{
+		printf("capture ring %6.0f frames/s read out with %6.0f requests/s, %u lost\n",
+		       bench_capture_frames / seconds, bench_capture_requests / seconds, arinc429.capture.frames_lost);
+	}
+}
+
+
+/****************************************************************************/
+/* main                                                                     */
+/****************************************************************************/
+
+int main(int argc, char **argv)
+{
+	const uint32_t seconds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 2;
+
+	bench_calibrate();
+
+	printf("ARINC429_RX_FRAME_BUDGET = %u (max. %u), ARINC429_TIMEOUT_CHECK_BUDGET = %u, ARINC429_TX_BURST_SIZE = %u, %u s per scenario\n",
+	       ARINC429_RX_FRAME_BUDGET, ARINC429_RX_FRAME_BUDGET_MAX, ARINC429_TIMEOUT_CHECK_BUDGET, ARINC429_TX_BURST_SIZE, seconds);
+	printf("measurement overhead of %lu ns / %lu cycles per call subtracted\n", bench_overhead_ns, bench_overhead_cycles);
+
+	for(uint8_t i = 0; i < sizeof(bench_scenario) / sizeof(bench_scenario[0]); i++)
+	{
+		host_firmware_init();
+
+		bench_capture_drain   = false;
+		bench_capture_next_ns = 0;
+		bench_tx_stream       = false;
+		bench_scenario[i].setup();
+
+		// measure from here on
+		bench_reset_statistics();
+
+		const uint64_t start_ns = hi3593_sim.time_ns;
+
+		bench_run_ms(seconds * 1000);
+
+		report(&bench_scenario[i], (hi3593_sim.time_ns - start_ns) / 1e9);
+	}
+
+	return 0;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -0,0 +1,149 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * arinc429_sim.c: Runs the firmware against the HI-3593 model and reports the traffic figures
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/* Usage: arinc429_sim [seconds]
+ *
+ * Scenario: the TX scheduler sends 8 labels back-to-back at high speed, the TX
+ * bus is wired to RX1. RX2 receives 64 labels at full high-speed line rate from
+ * a simulated LRU. Both receivers use the standard filters and frame callbacks.
+ */
+
+#include "host_platform.h"
+#include "host_api.h"
+#include "hi3593_sim.h"
+
+#include "arinc429.h"
+#include "communication.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/****************************************************************************/
+/* data structures                                                          */
+/****************************************************************************/
+
+static uint32_t lru_frame[64];
+
+
+/****************************************************************************/
+/* local functions                                                          */
+/****************************************************************************/
+
+/* set up the firmware like a host program would do */
+static void scenario_setup(void)
+{
+	// let the firmware initialize the chip
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_TX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+	api_set_channel_configuration(ARINC429_CHANNEL_RX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+
+	api_set_rx_standard_filters(ARINC429_CHANNEL_RX);
+	api_set_rx_callback_configuration(ARINC429_CHANNEL_RX, true, false, 1000);
+
+	// RX2: the first three labels of the LRU go to the priority label mail boxes
+	api_set_rx_priority_configuration(ARINC429_CHANNEL_RX2, ARINC429_PRIORITY_ENABLED, 0x40, 0x41, 0x42);
+
+	// TX schedule: 8 labels, no dwell time between them, 3 ms after the last one
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		api_write_frame_scheduled(ARINC429_CHANNEL_TX, i, (0x100 * i) | (i + 1));
+		api_set_schedule_entry   (ARINC429_CHANNEL_TX, i, ARINC429_SCHEDULER_JOB_CYCLIC, i, (i == 7) ? 3 : 0);
+	}
+
+	// RX2 traffic: 64 labels, minimum word gap
+	for(uint8_t i = 0; i < 64; i++)
+	{
+		lru_frame[i] = ((uint32_t)i << 10) | (0x40 + i);
+	}
+
+	hi3593_sim_set_loopback (1 << 0);
+	hi3593_sim_set_rx_source(1, lru_frame, 64, ARINC429_SPEED_HS, HI3593_SIM_GAP_BITS_MIN);
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_ACTIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_RUN   );
+}
+
+
+/* print the figures of one RX channel */
+static void report_rx(const uint8_t i, const double seconds)
+{
+	HI3593SimRX       *chip    = &(hi3593_sim.rx[i]);
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+	printf("RX%u  bus %8u  stored %8u  overwritten %8u  read %8u  FIFO max %2u  overflows %u  processed %6u  lost %6u  (%.0f frames/s)\n",
+	       i + 1, chip->words_on_bus, chip->words_stored, chip->words_overwritten, chip->words_read, chip->fifo_high_water, channel->fifo_overflows,
+	       channel->common.frames_processed_curr, channel->common.frames_lost_curr, chip->words_read / seconds);
+}
+
+
+/****************************************************************************/
+/* main                                                                     */
+/****************************************************************************/
+
+int main(int argc, char **argv)
+{
+	const uint32_t seconds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 10;
+
+	host_firmware_init();
+	scenario_setup();
+
+	// measure from here on
+	const uint64_t start_ns    = hi3593_sim.time_ns;
+	const uint64_t start_loops = host_platform.loop_iterations;
+
+	host_firmware_run_ms(seconds * 1000);
+
+	const double elapsed = (hi3593_sim.time_ns - start_ns) / 1e9;
+
+	printf("simulated %.1f s, %.0f main loop passes/s\n", elapsed, (host_platform.loop_iterations - start_loops) / elapsed);
+	printf("TX   written %8u  ignored %8u  transmitted %8u  processed %6u  lost %6u\n",
+	       hi3593_sim.tx.words_written, hi3593_sim.tx.words_ignored, hi3593_sim.tx.words_transmitted,
+	       arinc429.tx_channel[0].common.frames_processed_curr, arinc429.tx_channel[0].common.frames_lost_curr);
+
+	report_rx(0, elapsed);
+	report_rx(1, elapsed);
+
+	printf("SPI  %u transactions, %.1f %% bus load\n", hi3593_sim.spi_transactions, 100.0 * hi3593_sim.spi_time_ns / (hi3593_sim.time_ns));
+	printf("TFP  %u callbacks (%u frame messages)\n", host_platform.messages_sent, host_platform.messages_by_fid[FID_CALLBACK_FRAME_MESSAGE]);
+
+	// the firmware's own view, as reported by get_performance_counters()
+	GetPerformanceCounters_Response perf;
+
+	if(api_get_performance_counters(&perf))
+	{
+		const char *stage_name[ARINC429_STAGES_NUM] = {"channel_config", "tx_immediate", "tx_scheduled", "receive_frames", "check_timeout", "heartbeat"};
+
+		printf("PERF %u main loop passes/s, callback queue max %u, TX queue max %u, RX budget exhausted %u / %u, %u SPI transactions\n",
+		       perf.loop_rate, perf.callback_high_water, perf.tx_queue_high_water, perf.budget_exhausted[0], perf.budget_exhausted[1], perf.spi_transactions);
+
+		for(uint8_t i = 0; i < ARINC429_STAGES_NUM; i++)
+		{
+			printf("     %-15s avg %5u us  max %5u us\n", stage_name[i], perf.stage_avg[i], perf.stage_max[i]);
+		}
+	}
+
+	return 0;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
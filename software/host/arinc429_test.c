@@ -0,0 +1,335 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * arinc429_test.c: Checks of the firmware behavior against the HI-3593 model
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/* Usage: arinc429_test
+ *
+ * Runs each check on a freshly initialized firmware and returns 0 if all of
+ * them pass. Registered with CTest, run it by 'ctest' in the build directory.
+ */
+
+#include "host_platform.h"
+#include "host_api.h"
+#include "hi3593_sim.h"
+
+#include "arinc429.h"
+#include "communication.h"
+
+#include "bricklib2/hal/system_timer/system_timer.h"
+
+#include <stdio.h>
+
+
+/****************************************************************************/
+/* checks                                                                   */
+/****************************************************************************/
+
+/* RX timeout of 60000 ms: the timeout group must not be scanned before it is due */
+static bool test_rx_timeout_horizon(void)
+{
+	static uint32_t frame = 0x0010;
+
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[0]);
+
+	uint32_t scans   = 0;    // number of main loop passes that found the group due
+	uint32_t elapsed = 0;    // time since the last frame [ms]
+
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_RX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+	api_set_rx_filter            (ARINC429_CHANNEL_RX1, 0x10, ARINC429_SDI_DATA);
+	api_set_rx_filter_timeout    (ARINC429_CHANNEL_RX1, 0x10, ARINC429_SDI_DATA, 60000);
+	api_set_channel_mode         (ARINC429_CHANNEL_RX1, ARINC429_CHANNEL_MODE_ACTIVE);
+
+	// receive the label for a short while, then stop the LRU
+	hi3593_sim_set_rx_source (0, &frame, 1, ARINC429_SPEED_HS, HI3593_SIM_GAP_BITS_MIN);
+	host_firmware_run_ms(2);
+	hi3593_sim_stop_rx_source(0);
+	host_firmware_run_ms(2);
+
+	ARINC429RXBuffer *buffer = &(channel->frame_buffer[channel->frame_filter[0x10]]);
+
+	// run until the timeout is reported
+	while(buffer->frame_age != ARINC429_RX_BUFFER_TIMEOUT)
+	{
+		const uint16_t curr_time = (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
+
+		elapsed = (uint16_t)(curr_time - buffer->last_rx_time);
+
+		if(elapsed > 61000)
+		{
+			printf("  no timeout after %u ms\n", elapsed);
+			return false;
+		}
+
+		// will the next pass scan the group? (same condition as in arinc429_task_check_timeout())
+		if(channel->timeout_armed[0] && ((uint16_t)(channel->timeout_due[0] - curr_time) >= ARINC429_RX_TIMEOUT_HORIZON))  scans++;
+
+		host_firmware_loop();
+	}
+
+	printf("  timeout after %u ms, group scanned %u times\n", elapsed, scans);
+
+	// the timeout is due after 60000 ms, the group is checked early each horizon only
+	return (elapsed >= 60000) && (elapsed <= 60002) && (scans <= 60000 / ARINC429_RX_TIMEOUT_HORIZON + 1);
+}
+
+
+/* monitor mode on RX1 + RX2: the capture read-out merges both channels in the order of arrival */
+static bool test_capture_read_out(void)
+{
+	static uint32_t frame_rx1[2] = {0x0010, 0x0011};
+	static uint32_t frame_rx2[1] = {0x0020};
+
+	static uint32_t frame    [ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+	static uint32_t timestamp[ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+	static uint8_t  channel  [ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE];
+
+	uint16_t frames_read = 0;
+	uint16_t frames_rx1  = 0;
+	uint16_t frames_rx2  = 0;
+
+	bool     status;
+	uint32_t value;
+	uint16_t age;
+
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_RX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+	api_set_rx_filter            (ARINC429_CHANNEL_RX1, 0x10, ARINC429_SDI_DATA);
+	api_set_channel_mode         (ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_MONITOR);
+	host_firmware_run_ms(5);
+
+	// the filters are locked while monitoring
+	if(api_set_rx_filter(ARINC429_CHANNEL_RX1, 0x11, ARINC429_SDI_DATA))
+	{
+		printf("  filter changed in monitor mode\n");
+		return false;
+	}
+
+	hi3593_sim_set_rx_source(0, frame_rx1, 2, ARINC429_SPEED_HS, HI3593_SIM_GAP_BITS_MIN);
+	hi3593_sim_set_rx_source(1, frame_rx2, 1, ARINC429_SPEED_HS, HI3593_SIM_GAP_BITS_MIN);
+	host_firmware_run_ms(30);
+	hi3593_sim_stop_rx_source(0);
+	hi3593_sim_stop_rx_source(1);
+	host_firmware_run_ms(2);
+
+	if(!api_read_capture(ARINC429_RX_CHANNELS_NUM * ARINC429_CAPTURE_SIZE, frame, timestamp, channel, &frames_read))
+	{
+		printf("  capture read-out failed\n");
+		return false;
+	}
+
+	for(uint16_t i = 0; i < frames_read; i++)
+	{
+		if(channel[i] == ARINC429_CHANNEL_RX1)  frames_rx1++;
+		if(channel[i] == ARINC429_CHANNEL_RX2)  frames_rx2++;
+
+		if((i > 0) && ((int32_t)(timestamp[i] - timestamp[i - 1]) < 0))
+		{
+			printf("  frame %u captured out of order\n", i);
+			return false;
+		}
+	}
+
+	printf("  %u frames captured, %u on RX1, %u on RX2, %u lost\n", frames_read, frames_rx1, frames_rx2, arinc429.capture.frames_lost);
+
+	if((frames_rx1 == 0) || (frames_rx2 == 0) || (frames_rx1 + frames_rx2 != frames_read))  return false;
+
+	// back in active mode the filter of RX1 is in place again, with an empty frame buffer
+	api_set_channel_mode(ARINC429_CHANNEL_RX, ARINC429_CHANNEL_MODE_ACTIVE);
+	host_firmware_run_ms(5);
+
+	if(!api_read_frame(ARINC429_CHANNEL_RX1, 0x10, ARINC429_SDI_DATA, &status, &value, &age) || status)
+	{
+		printf("  frame buffer of label 0x10 not restored\n");
+		return false;
+	}
+
+	return true;
+}
+
+
+/* sparse job table: the scheduler passes the unused entries, which read back as they were set */
+static bool test_schedule_read_back(void)
+{
+	uint8_t  job;
+	uint16_t frame_index;
+	uint8_t  dwell_time;
+
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_TX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+	api_write_frame_scheduled    (ARINC429_CHANNEL_TX, 0, 0x0010);
+	api_write_frame_scheduled    (ARINC429_CHANNEL_TX, 1, 0x0011);
+
+	// two cyclic jobs far apart, an unused entry with a frame index and dwell time between them
+	api_set_schedule_entry(ARINC429_CHANNEL_TX,  100, ARINC429_SCHEDULER_JOB_CYCLIC, 0, 1);
+	api_set_schedule_entry(ARINC429_CHANNEL_TX,  500, ARINC429_SCHEDULER_JOB_SKIP,   7, 3);
+	api_set_schedule_entry(ARINC429_CHANNEL_TX,  900, ARINC429_SCHEDULER_JOB_CYCLIC, 1, 1);
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_PASSIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_RUN    );
+	host_firmware_run_ms(100);
+
+	// one frame per ms
+	uint32_t frames_sent = arinc429.tx_channel[0].common.frames_processed_curr;
+
+	printf("  %u frames sent in 100 ms\n", frames_sent);
+
+	if((frames_sent < 99) || (frames_sent > 101))  return false;
+
+	// the unused entry reads back unchanged
+	if(!api_get_schedule_entry(ARINC429_CHANNEL_TX1, 500, &job, &frame_index, &dwell_time))  return false;
+
+	printf("  unused entry: job %u, frame index %u\n", job, frame_index);
+
+	return (job == ARINC429_SCHEDULER_JOB_SKIP) && (frame_index == 7);
+}
+
+
+/* staged commit with a subroutine ahead of its caller: the backward JUMP of the call does not apply it, */
+/* the wrap-around to job 0 does                                                                          */
+static bool test_schedule_commit_subroutine(void)
+{
+	uint64_t start_ns;
+	uint32_t frames_seen;
+	uint32_t frames_new = 0;  // number of frames with the label of the new schedule
+	uint8_t  cycle      = 0;  // number of schedule cycles started since the commit
+	uint8_t  status;
+	uint8_t  entries_staged;
+	bool     commit_pending;
+
+	host_firmware_run_ms(300);
+
+	api_set_channel_configuration(ARINC429_CHANNEL_TX, ARINC429_PARITY_AUTO, ARINC429_SPEED_HS);
+
+	for(uint8_t i = 0; i < 4; i++)  api_write_frame_scheduled(ARINC429_CHANNEL_TX, i, 0x0010 + i);
+
+	// jump over the subroutine to the main part
+	api_set_schedule_entry(ARINC429_CHANNEL_TX,   0, ARINC429_SCHEDULER_JOB_JUMP,   600, 0);
+
+	// subroutine: label 0x12
+	api_set_schedule_entry(ARINC429_CHANNEL_TX, 500, ARINC429_SCHEDULER_JOB_CYCLIC, 2,   1);
+	api_set_schedule_entry(ARINC429_CHANNEL_TX, 501, ARINC429_SCHEDULER_JOB_RETURN, 0,   0);
+
+	// main part: label 0x10, call of the subroutine, label 0x11, then on to the table end
+	api_set_schedule_entry(ARINC429_CHANNEL_TX, 600, ARINC429_SCHEDULER_JOB_CYCLIC, 0,   1);
+	api_set_schedule_entry(ARINC429_CHANNEL_TX, 601, ARINC429_SCHEDULER_JOB_JUMP,   500, 0);
+	api_set_schedule_entry(ARINC429_CHANNEL_TX, 602, ARINC429_SCHEDULER_JOB_CYCLIC, 1,   1);
+
+	api_set_channel_mode(ARINC429_CHANNEL_RX,  ARINC429_CHANNEL_MODE_PASSIVE);
+	api_set_channel_mode(ARINC429_CHANNEL_TX1, ARINC429_CHANNEL_MODE_RUN    );
+	host_firmware_run_ms(4);
+
+	// label 0x11 becomes label 0x13 with the next schedule cycle
+	api_stage_schedule_entry(ARINC429_CHANNEL_TX, 602, ARINC429_SCHEDULER_JOB_CYCLIC, 3, 1, &status);
+	api_commit_schedule     (ARINC429_CHANNEL_TX, ARINC429_SCHEDULE_COMMIT);
+
+	frames_seen = hi3593_sim.tx.words_written;
+	start_ns    = hi3593_sim.time_ns;
+
+	// check the frames written until 3 complete cycles are done
+	while(cycle < 4)
+	{
+		// a cycle takes 3 ms
+		if(hi3593_sim.time_ns - start_ns > 20000000)
+		{
+			printf("  only %u cycles started in 20 ms\n", cycle);
+			return false;
+		}
+
+		host_firmware_loop();
+
+		while(frames_seen < hi3593_sim.tx.words_written)
+		{
+			uint32_t back  = hi3593_sim.tx.words_written - frames_seen++;
+			uint8_t  label = hi3593_sim.tx.fifo[(hi3593_sim.tx.fifo_tail + hi3593_sim.tx.fifo_count - back) % HI3593_SIM_FIFO_DEPTH] & 0xFF;
+
+			// count the cycles by their first frame
+			if(label == 0x10)  cycle++;
+
+			// the old label must not be sent once a new cycle has started
+			if((cycle > 0) && (label == 0x11))
+			{
+				printf("  old schedule sent in cycle %u\n", cycle);
+				return false;
+			}
+
+			// count the new label in the complete cycles
+			if((cycle > 0) && (cycle < 4) && (label == 0x13))  frames_new++;
+		}
+	}
+
+	api_get_schedule_commit_status(ARINC429_CHANNEL_TX1, &entries_staged, &commit_pending);
+
+	printf("  label of the new schedule sent %u times in 3 cycles, commit pending: %u\n", frames_new, commit_pending);
+
+	// each cycle returns from the subroutine into the main part
+	return (frames_new == 3) && (entries_staged == 0) && !commit_pending;
+}
+
+
+/****************************************************************************/
+/* main                                                                     */
+/****************************************************************************/
+
+typedef struct
+{
+	const char *name;
+	bool      (*check)(void);
+}
+TestCase;
+
+static const TestCase test_case[] =
+{
+	{"rx_timeout_horizon",         test_rx_timeout_horizon        },
+	{"capture_read_out",           test_capture_read_out          },
+	{"schedule_read_back",         test_schedule_read_back        },
+	{"schedule_commit_subroutine", test_schedule_commit_subroutine},
+};
+
+
+int main(void)
+{
+	uint32_t failed = 0;
+
+	for(uint32_t i = 0; i < sizeof(test_case) / sizeof(test_case[0]); i++)
+	{
+		printf("%s\n", test_case[i].name);
+
+		host_firmware_init();
+
+		if(test_case[i].check())
+		{
+			printf("  passed\n");
+		}
+		else
+		{
+			printf("  FAILED\n");
+			failed++;
+		}
+	}
+
+	return (failed == 0) ? 0 : 1;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -0,0 +1,759 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * hi3593_sim.c: Software model of the HI-3593 ARINC429 IC for host builds
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/* This file replaces src/hi3593.c in the host build. It implements the same
+ * driver interface, but instead of talking SPI to a real chip it operates a
+ * model of the HI-3593 that runs on a simulated clock:
+ *
+ * - every SPI transaction advances the clock by its transfer time
+ * - words arrive on the receivers from configurable traffic sources at line rate
+ * - the transmitter drains its FIFO at line rate, optionally looped back to the receivers
+ * - the discretes (flags, mail boxes, TX FIFO status) are computed from the chip state
+ */
+
+#include "hi3593_sim.h"
+
+#include "bricklib2/hal/system_timer/system_timer.h"
+
+#include <string.h>
+
+#include "opcode_length.inc"
+
+
+/****************************************************************************/
+/* data structures                                                          */
+/****************************************************************************/
+
+// chip model
+HI3593Sim hi3593_sim;
+
+// data structure used for all driver functions
+HI3593    hi3593;
+
+// pin and port numbers to interface with the discrete signals of the A429 chip
+const uint8_t hi3593_input_pins[HI3593_INPUT_PINS_NUM] =
+{
+	HI3593_MB11_PIN,
+	HI3593_MB12_PIN,
+	HI3593_MB13_PIN,
+	HI3593_MB21_PIN,
+	HI3593_MB22_PIN,
+	HI3593_MB23_PIN,
+	HI3593_R2INT_PIN,
+	HI3593_R2FLAG_PIN,
+	HI3593_R1INT_PIN,
+	HI3593_R1FLAG_PIN,
+	HI3593_TEMPTY_PIN,
+	HI3593_TFULL_PIN
+};
+
+XMC_GPIO_PORT_t *const hi3593_input_ports[HI3593_INPUT_PINS_NUM] =
+{
+	HI3593_MB11_PORT,
+	HI3593_MB12_PORT,
+	HI3593_MB13_PORT,
+	HI3593_MB21_PORT,
+	HI3593_MB22_PORT,
+	HI3593_MB23_PORT,
+	HI3593_R2INT_PORT,
+	HI3593_R2FLAG_PORT,
+	HI3593_R1INT_PORT,
+	HI3593_R1FLAG_PORT,
+	HI3593_TEMPTY_PORT,
+	HI3593_TFULL_PORT
+};
+
+
+/****************************************************************************/
+/* local helper functions                                                   */
+/****************************************************************************/
+
+/* time one word occupies the bus, including the gap to the next word */
+static uint64_t hi3593_sim_word_time(const uint8_t low_speed, const uint8_t gap_bits)
+{
+	return (uint64_t)(32 + gap_bits) * (low_speed ? HI3593_SIM_BIT_TIME_LS_NS : HI3593_SIM_BIT_TIME_HS_NS);
+}
+
+
+/* check if a label is enabled in the label filter memory */
+static bool hi3593_sim_label_enabled(const HI3593SimRX *rx, const uint8_t label)
+{
+	// the memory starts with label 0xFF in bit 7 of byte 0
+	return (rx->label_filter[31 - (label >> 3)] & (1 << (label & 0x07))) ? true : false;
+}
+
+
+/* clear the FIFOs and the mail boxes */
+static void hi3593_sim_clear_buffers(void)
+{
+	for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+	{
+		hi3593_sim.rx[i].fifo_tail  = 0;
+		hi3593_sim.rx[i].fifo_count = 0;
+
+		memset(hi3593_sim.rx[i].mailbox_full, 0, sizeof(hi3593_sim.rx[i].mailbox_full));
+	}
+
+	hi3593_sim.tx.fifo_tail  = 0;
+	hi3593_sim.tx.fifo_count = 0;
+}
+
+
+/* master reset: all registers to 0x00, all buffers cleared */
+static void hi3593_sim_master_reset(void)
+{
+	for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+	{
+		hi3593_sim.rx[i].ctrl = 0;
+
+		memset(hi3593_sim.rx[i].label_filter,   0, sizeof(hi3593_sim.rx[i].label_filter  ));
+		memset(hi3593_sim.rx[i].priority_match, 0, sizeof(hi3593_sim.rx[i].priority_match));
+	}
+
+	hi3593_sim.tx.ctrl     = 0;
+	hi3593_sim.tx.shifting = false;
+	hi3593_sim.flag_irq    = 0;
+	hi3593_sim.aclk_div    = 0;
+
+	hi3593_sim_clear_buffers();
+}
+
+
+/* pulse RxINT if it is assigned to the given event (0 = FIFO or any mail box, 1..3 = mail box #1..#3) */
+static void hi3593_sim_rx_int(const uint8_t index, const uint8_t mailbox)
+{
+	// R1INT is assigned in bits 3-2, R2INT in bits 7-6 of the flag / interrupt assignment register
+	const uint8_t assignment = (hi3593_sim.flag_irq >> ((index == 0) ? 2 : 6)) & 0x03;
+
+	if(hi3593_sim.rx[index].int_disconnected)  return;
+
+	if((assignment == 0) || (assignment == mailbox))  hi3593_rx_int(index);
+}
+
+
+/* a word has been received completely by a receiver */
+static void hi3593_sim_rx_word(const uint8_t index, uint32_t word, const uint8_t low_speed)
+{
+	HI3593SimRX *rx    = &(hi3593_sim.rx[index]);
+	uint8_t      label = (uint8_t)(word & 0xFF);
+
+	rx->words_on_bus++;
+
+	// a receiver set to the other speed does not decode the word
+	if((rx->ctrl & 0x01) != low_speed)
+	{
+		rx->words_rejected++;
+		return;
+	}
+
+	// parity check enabled? (odd parity, bit 32 is set on parity error)
+	if(rx->ctrl & (1 << 3))
+	{
+		if(__builtin_popcount(word) & 1) word &= ~(1u << 31);
+		else                             word |=  (1u << 31);
+	}
+
+	// SD bit decoder enabled? (bits 9 and 10 must match SD9 and SD10)
+	if(rx->ctrl & (1 << 4))
+	{
+		if(    (((word >> 8) & 1) != ((rx->ctrl >> 6) & 1))
+		    || (((word >> 9) & 1) != ((rx->ctrl >> 5) & 1)) )
+		{
+			rx->words_rejected++;
+			return;
+		}
+	}
+
+	// priority label mail boxes enabled?
+	if(rx->ctrl & (1 << 1))
+	{
+		for(uint8_t k = 0; k < 3; k++)
+		{
+			if(label == rx->priority_match[k])
+			{
+				// the mail boxes store bits 9 - 32 only, a new word overwrites an unread one
+				rx->mailbox[k]      = word >> 8;
+				rx->mailbox_full[k] = true;
+				rx->words_stored++;
+
+				hi3593_sim_rx_int(index, k + 1);
+
+				return;
+			}
+		}
+	}
+
+	// label filter enabled and label not selected?
+	if((rx->ctrl & (1 << 2)) && !hi3593_sim_label_enabled(rx, label))
+	{
+		rx->words_rejected++;
+		return;
+	}
+
+	// store the word in the FIFO
+	if(rx->fifo_count < HI3593_SIM_FIFO_DEPTH)
+	{
+		rx->fifo[(rx->fifo_tail + rx->fifo_count) % HI3593_SIM_FIFO_DEPTH] = word;
+		rx->fifo_count++;
+		rx->words_stored++;
+	}
+	else
+	{
+		// FIFO full: the newest word overwrites FIFO location 32
+		rx->fifo[(rx->fifo_tail + HI3593_SIM_FIFO_DEPTH - 1) % HI3593_SIM_FIFO_DEPTH] = word;
+		rx->words_overwritten++;
+	}
+
+	if(rx->fifo_count > rx->fifo_high_water)  rx->fifo_high_water = rx->fifo_count;
+
+	hi3593_sim_rx_int(index, 0);
+}
+
+
+/* load the next word from the TX FIFO into the shift register */
+static void hi3593_sim_tx_start(const uint64_t start_ns)
+{
+	HI3593SimTX *tx = &(hi3593_sim.tx);
+
+	if(tx->fifo_count == 0)
+	{
+		tx->shifting = false;
+		return;
+	}
+
+	uint32_t word = tx->fifo[tx->fifo_tail];
+
+	tx->fifo_tail = (tx->fifo_tail + 1) % HI3593_SIM_FIFO_DEPTH;
+	tx->fifo_count--;
+
+	// parity generation enabled? (ODDEVEN = 0 selects odd parity)
+	if(tx->ctrl & (1 << 2))
+	{
+		word = hi3593_sim_add_parity(word);
+		if(tx->ctrl & (1 << 3))  word ^= (1u << 31);
+	}
+
+	tx->shift_frame   = word;
+	tx->shift_done_ns = start_ns + hi3593_sim_word_time(tx->ctrl & 0x01, HI3593_SIM_GAP_BITS_MIN);
+	tx->shifting      = true;
+}
+
+
+/* process all bus events up to the current simulated time */
+static void hi3593_sim_process(void)
+{
+	while(true)
+	{
+		int8_t   next    = -1;                      // 0..1 = receiver source, 2 = transmitter
+		uint64_t next_ns = hi3593_sim.time_ns + 1;
+
+		// find the earliest due event
+		for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+		{
+			HI3593SimRX *rx = &(hi3593_sim.rx[i]);
+
+			if(rx->source_active && (rx->source_next_ns < next_ns))
+			{
+				next    = i;
+				next_ns = rx->source_next_ns;
+			}
+		}
+
+		if(hi3593_sim.tx.shifting && (hi3593_sim.tx.shift_done_ns < next_ns))
+		{
+			next    = 2;
+			next_ns = hi3593_sim.tx.shift_done_ns;
+		}
+
+		// done if nothing is due
+		if(next < 0)  return;
+
+		// the event happens in the past, let the RxINT interrupts see its time
+		const uint64_t now_ns = hi3593_sim.time_ns;
+
+		hi3593_sim.time_ns = next_ns;
+
+		if(next < HI3593_SIM_RX_CHANNELS_NUM)
+		{
+			// word from a traffic source
+			HI3593SimRX *rx   = &(hi3593_sim.rx[next]);
+			uint32_t     word = hi3593_sim_add_parity(rx->source_frame[rx->source_index]);
+
+			if(++rx->source_index >= rx->source_frames_num)  rx->source_index = 0;
+
+			// inject a parity error?
+			if(rx->source_parity_error_interval && ((rx->words_on_bus + 1) % rx->source_parity_error_interval == 0))
+			{
+				word ^= (1u << 31);
+			}
+
+			rx->source_next_ns += hi3593_sim_word_time(rx->source_speed, rx->source_gap_bits);
+
+			hi3593_sim_rx_word(next, word, rx->source_speed);
+		}
+		else
+		{
+			// word transmitted
+			HI3593SimTX *tx = &(hi3593_sim.tx);
+
+			tx->words_transmitted++;
+
+			// self-test loops the transmitter internally to receiver 1, otherwise the bus is used unless in HI-Z
+			if(tx->ctrl & (1 << 4))
+			{
+				hi3593_sim_rx_word(0, tx->shift_frame, tx->ctrl & 0x01);
+			}
+			else if(!(tx->ctrl & (1 << 7)))
+			{
+				for(uint8_t i = 0; i < HI3593_SIM_RX_CHANNELS_NUM; i++)
+				{
+					if(tx->loopback & (1 << i))  hi3593_sim_rx_word(i, tx->shift_frame, tx->ctrl & 0x01);
+				}
+			}
+
+			hi3593_sim_tx_start(tx->shift_done_ns);
+		}
+
+		hi3593_sim.time_ns = now_ns;
+	}
+}
+
+
+/* account for the duration of a SPI transaction */
+static void hi3593_sim_spi_transfer(const uint8_t length)
+{
+	uint64_t duration = hi3593_sim.spi_overhead_ns + (uint64_t)(length + 1) * hi3593_sim.spi_byte_ns;
+
+	hi3593_sim.spi_transactions++;
+	hi3593.spi_transactions++;
+	hi3593_sim.spi_bytes   += length + 1;
+	hi3593_sim.spi_time_ns += duration;
+
+	hi3593_sim_advance_ns(duration);
+}
+
+
+/* level of a RxFLAG pin for the given FLAG assignment */
+static uint32_t hi3593_sim_flag_pin(const HI3593SimRX *rx, const uint8_t assignment)
+{
+	switch(assignment & 0x03)
+	{
+		case 0x00 : return (rx->fifo_count == 0                    ) ? 1 : 0;  // FIFO empty
+		case 0x01 : return (rx->fifo_count == HI3593_SIM_FIFO_DEPTH) ? 1 : 0;  // FIFO full
+		case 0x02 : return (rx->fifo_count >= 16                   ) ? 1 : 0;  // FIFO half full
+		default   : return (rx->fifo_count >  0                    ) ? 1 : 0;  // FIFO not empty
+	}
+}
+
+
+/****************************************************************************/
+/* model control                                                            */
+/****************************************************************************/
+
+/* initialize the model, power-on state */
+void hi3593_sim_init(void)
+{
+	memset(&hi3593_sim, 0, sizeof(HI3593Sim));
+
+	hi3593_sim.spi_overhead_ns = HI3593_SIM_SPI_OVERHEAD_NS;
+	hi3593_sim.spi_byte_ns     = 8 * (1000000000 / HI3593_SPI_BAUDRATE);
+
+	hi3593_sim_master_reset();
+}
+
+
+/* advance the simulated time */
+void hi3593_sim_advance_ns(const uint64_t ns)
+{
+	hi3593_sim.time_ns += ns;
+
+	hi3593_sim_process();
+}
+
+
+/* set bit 32 of a frame for odd parity */
+uint32_t hi3593_sim_add_parity(const uint32_t frame)
+{
+	uint32_t word = frame & 0x7FFFFFFF;
+
+	return (__builtin_popcount(word) & 1) ? word : (word | (1u << 31));
+}
+
+
+/* start a traffic source sending the given frames cyclically to a receiver */
+void hi3593_sim_set_rx_source(const uint8_t rx, const uint32_t *frame, const uint16_t frames_num, const uint8_t speed, const uint8_t gap_bits)
+{
+	HI3593SimRX *channel = &(hi3593_sim.rx[rx]);
+
+	channel->source_frame      = frame;
+	channel->source_frames_num = frames_num;
+	channel->source_index      = 0;
+	channel->source_speed      = speed ? 1 : 0;
+	channel->source_gap_bits   = (gap_bits < HI3593_SIM_GAP_BITS_MIN) ? HI3593_SIM_GAP_BITS_MIN : gap_bits;
+	channel->source_next_ns    = hi3593_sim.time_ns + hi3593_sim_word_time(channel->source_speed, channel->source_gap_bits);
+	channel->source_active     = (frames_num > 0);
+}
+
+
+/* stop the traffic source of a receiver */
+void hi3593_sim_stop_rx_source(const uint8_t rx)
+{
+	hi3593_sim.rx[rx].source_active = false;
+}
+
+
+/* let every n-th word of a traffic source have a parity error (0 = none) */
+void hi3593_sim_set_parity_errors(const uint8_t rx, const uint32_t interval)
+{
+	hi3593_sim.rx[rx].source_parity_error_interval = interval;
+}
+
+
+/* cut the RxINT line of a receiver, the firmware then has to poll the FIFO */
+void hi3593_sim_disconnect_rx_int(const uint8_t rx, const bool disconnected)
+{
+	hi3593_sim.rx[rx].int_disconnected = disconnected;
+}
+
+
+/* wire the TX bus to the receivers (bit 0 = RX1, bit 1 = RX2) */
+void hi3593_sim_set_loopback(const uint8_t rx_mask)
+{
+	hi3593_sim.tx.loopback = rx_mask;
+}
+
+
+/****************************************************************************/
+/* driver interface (see src/hi3593.c)                                      */
+/****************************************************************************/
+
+/* initialize driver data structure */
+void hi3593_init_data(void)
+{
+	// clear data structure
+	memset(&hi3593, 0, sizeof(HI3593));
+}
+
+
+/* initialize XMC (host) chip */
+void hi3593_init_chip(void)
+{
+	// the SPI speed determines the transfer time of the model
+	hi3593.spi_fifo.baudrate = HI3593_SPI_BAUDRATE;
+
+	// configure RX/TX LEDs
+	hi3593.led_flicker_state_rx.config = LED_FLICKER_CONFIG_STATUS;
+	hi3593.led_flicker_state_tx.config = LED_FLICKER_CONFIG_STATUS;
+}
+
+
+/* SPI write access to A429 chip */
+uint32_t hi3593_write_register(const uint8_t opcode, const uint8_t *data, const uint8_t length)
+{
+	uint8_t index;
+
+	// bring the chip state up to date
+	hi3593_sim_process();
+
+	switch(opcode)
+	{
+		case HI3593_CMD_MASTER_RESET     : hi3593_sim_master_reset();   break;
+		case 0x44                        : hi3593_sim_clear_buffers();  break;  // software reset
+
+		case HI3593_CMD_WRITE_FLAG_IRQ   : hi3593_sim.flag_irq = data[0];  break;
+		case HI3593_CMD_WRITE_ACLK_DIV   : hi3593_sim.aclk_div = data[0];  break;
+
+		case HI3593_CMD_WRITE_TX1_CTRL   : hi3593_sim.tx.ctrl  = data[0];  break;
+
+		case HI3593_CMD_WRITE_TX1_FIFO   :
+
+			// a full FIFO ignores further loads
+			if(hi3593_sim.tx.fifo_count < HI3593_SIM_FIFO_DEPTH)
+			{
+				index = (hi3593_sim.tx.fifo_tail + hi3593_sim.tx.fifo_count) % HI3593_SIM_FIFO_DEPTH;
+
+				hi3593_sim.tx.fifo[index] = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+				hi3593_sim.tx.fifo_count++;
+				hi3593_sim.tx.words_written++;
+			}
+			else
+			{
+				hi3593_sim.tx.words_ignored++;
+			}
+
+			// TMODE = 1 starts the transmission as soon as a word is available
+			if((hi3593_sim.tx.ctrl & (1 << 5)) && !hi3593_sim.tx.shifting)  hi3593_sim_tx_start(hi3593_sim.time_ns);
+
+			break;
+
+		case 0x40                        :  // transmit FIFO contents
+
+			if(!hi3593_sim.tx.shifting)  hi3593_sim_tx_start(hi3593_sim.time_ns);
+			break;
+
+		case HI3593_CMD_WRITE_RX1_CTRL   : /* FALLTHROUGH */
+		case HI3593_CMD_WRITE_RX2_CTRL   :
+
+			hi3593_sim.rx[(opcode == HI3593_CMD_WRITE_RX1_CTRL) ? 0 : 1].ctrl = data[0];
+			break;
+
+		case HI3593_CMD_WRITE_RX1_FILTER : /* FALLTHROUGH */
+		case HI3593_CMD_WRITE_RX2_FILTER :
+
+			memcpy(hi3593_sim.rx[(opcode == HI3593_CMD_WRITE_RX1_FILTER) ? 0 : 1].label_filter, data, 32);
+			break;
+
+		case 0x48                        : /* FALLTHROUGH */  // set all label bits, receiver 1
+		case 0x4C                        :                    // set all label bits, receiver 2
+
+			memset(hi3593_sim.rx[(opcode == 0x48) ? 0 : 1].label_filter, 0xFF, 32);
+			break;
+
+		case HI3593_CMD_WRITE_RX1_PRIO   : /* FALLTHROUGH */
+		case HI3593_CMD_WRITE_RX2_PRIO   :
+
+			// the first byte is the match value for register #3, the last one for register #1
+			index = (opcode == HI3593_CMD_WRITE_RX1_PRIO) ? 0 : 1;
+
+			hi3593_sim.rx[index].priority_match[2] = data[0];
+			hi3593_sim.rx[index].priority_match[1] = data[1];
+			hi3593_sim.rx[index].priority_match[0] = data[2];
+			break;
+
+		default                          : break;
+	}
+
+	// account for the transfer time
+	hi3593_sim_spi_transfer(length);
+
+	// done
+	return 0;
+}
+
+
+/* SPI read access to A429 chip */
+uint32_t hi3593_read_register(const uint8_t opcode, uint8_t *data, const uint8_t length)
+{
+	HI3593SimRX *rx;
+	uint32_t     word;
+
+	// bring the chip state up to date
+	hi3593_sim_process();
+
+	memset(data, 0, length);
+
+	switch((1 << 7) | opcode)
+	{
+		case HI3593_CMD_READ_TX1_STATUS :
+
+			data[0] =   ((hi3593_sim.tx.fifo_count == HI3593_SIM_FIFO_DEPTH) ? (1 << 2) : 0)
+			          | ((hi3593_sim.tx.fifo_count >= 16                   ) ? (1 << 1) : 0)
+			          | ((hi3593_sim.tx.fifo_count == 0                    ) ? (1 << 0) : 0);
+			break;
+
+		case HI3593_CMD_READ_TX1_CTRL : data[0] = hi3593_sim.tx.ctrl;      break;
+		case HI3593_CMD_READ_RX1_CTRL : data[0] = hi3593_sim.rx[0].ctrl;   break;
+		case HI3593_CMD_READ_RX2_CTRL : data[0] = hi3593_sim.rx[1].ctrl;   break;
+		case 0xD0                     : data[0] = hi3593_sim.flag_irq;     break;  // flag / interrupt assignment
+		case 0xD4                     : data[0] = hi3593_sim.aclk_div;     break;  // ACLK division
+
+		case HI3593_CMD_READ_RX1_STATUS : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_STATUS :
+
+			rx = &(hi3593_sim.rx[(opcode == HI3593_CMD_READ_RX1_STATUS) ? 0 : 1]);
+
+			data[0] =   (rx->mailbox_full[2]                            ? (1 << 5) : 0)
+			          | (rx->mailbox_full[1]                            ? (1 << 4) : 0)
+			          | (rx->mailbox_full[0]                            ? (1 << 3) : 0)
+			          | ((rx->fifo_count == HI3593_SIM_FIFO_DEPTH)      ? (1 << 2) : 0)
+			          | ((rx->fifo_count >= 16                   )      ? (1 << 1) : 0)
+			          | ((rx->fifo_count == 0                    )      ? (1 << 0) : 0);
+			break;
+
+		case 0x98 : /* FALLTHROUGH */  // receiver 1 label memory
+		case 0xB8 :                    // receiver 2 label memory
+
+			memcpy(data, hi3593_sim.rx[(opcode == 0x98) ? 0 : 1].label_filter, 32);
+			break;
+
+		case HI3593_CMD_READ_RX1_PRIO : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_PRIO :
+
+			rx = &(hi3593_sim.rx[(opcode == HI3593_CMD_READ_RX1_PRIO) ? 0 : 1]);
+
+			data[0] = rx->priority_match[2];
+			data[1] = rx->priority_match[1];
+			data[2] = rx->priority_match[0];
+			break;
+
+		case HI3593_CMD_READ_RX1_FIFO : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_FIFO :
+
+			rx = &(hi3593_sim.rx[(opcode == HI3593_CMD_READ_RX1_FIFO) ? 0 : 1]);
+
+			// reading an empty FIFO delivers no valid data
+			if(rx->fifo_count == 0)  break;
+
+			word          = rx->fifo[rx->fifo_tail];
+			rx->fifo_tail = (rx->fifo_tail + 1) % HI3593_SIM_FIFO_DEPTH;
+			rx->fifo_count--;
+			rx->words_read++;
+
+			// highest byte first
+			data[0] = (uint8_t)(word >> 24);
+			data[1] = (uint8_t)(word >> 16);
+			data[2] = (uint8_t)(word >>  8);
+			data[3] = (uint8_t)(word >>  0);
+			break;
+
+		case HI3593_CMD_READ_RX1_PRIO1 : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX1_PRIO2 : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX1_PRIO3 : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_PRIO1 : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_PRIO2 : /* FALLTHROUGH */
+		case HI3593_CMD_READ_RX2_PRIO3 :
+
+			rx   = &(hi3593_sim.rx[(opcode < HI3593_CMD_READ_RX2_FIFO) ? 0 : 1]);
+			word = ((opcode & 0x0F) >> 2) - 1;    // mail box index 0..2
+
+			// bits 9 - 32, highest byte first
+			data[0] = (uint8_t)(rx->mailbox[word] >> 16);
+			data[1] = (uint8_t)(rx->mailbox[word] >>  8);
+			data[2] = (uint8_t)(rx->mailbox[word] >>  0);
+
+			rx->mailbox_full[word] = false;
+			rx->words_read++;
+			break;
+
+		default : break;
+	}
+
+	// account for the transfer time
+	hi3593_sim_spi_transfer(length);
+
+	// done
+	return 0;
+}
+
+
+/* record the arrival time of a frame, called on each RxINT pulse (see src/hi3593.c) */
+void hi3593_rx_int(const uint8_t channel)
+{
+	const uint16_t time = (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
+
+	// the MBx full discretes are taken from the model directly, XMC_GPIO_GetInput() would re-enter hi3593_sim_process()
+	for(uint8_t k = 0; k < 3; k++)
+	{
+		if(hi3593.rx_mailbox_full[channel][k])  continue;
+
+		if(hi3593_sim.rx[channel].mailbox_full[k])
+		{
+			hi3593.rx_mailbox_time[channel][k] = time;
+			hi3593.rx_mailbox_full[channel][k] = true;
+
+			return;
+		}
+	}
+
+	const uint8_t head = hi3593.rx_arrival_head[channel];
+
+	hi3593.rx_arrival_time[channel][head & (HI3593_RX_ARRIVAL_QUEUE_SIZE - 1)] = time;
+
+	hi3593.rx_arrival_head[channel] = head + 1;
+}
+
+
+/* read several frames from a RX FIFO, one SPI transaction per frame */
+uint32_t hi3593_read_fifo(const uint8_t opcode, uint8_t *data, const uint8_t frames_num)
+{
+	uint32_t errors = 0;
+
+	for(uint8_t i = 0; i < frames_num; i++)
+	{
+		errors += hi3593_read_register(opcode, data + 4*i, 4);
+	}
+
+	return errors;
+}
+
+
+/* write several frames into the TX FIFO, one SPI transaction per frame */
+uint32_t hi3593_write_fifo(const uint8_t opcode, const uint8_t *data, const uint8_t frames_num)
+{
+	uint32_t errors = 0;
+
+	for(uint8_t i = 0; i < frames_num; i++)
+	{
+		errors += hi3593_write_register(opcode, data + 4*i, 4);
+	}
+
+	return errors;
+}
+
+
+/* CPU clock cycles, derived from the simulated time */
+uint32_t hi3593_get_cycles(void)
+{
+	return (uint32_t)(hi3593_sim.time_ns * HI3593_CYCLES_PER_US / 1000);
+}
+
+
+/* discretes of the A429 chip, all of them are wired to port 2 */
+uint32_t XMC_GPIO_GetInput(XMC_GPIO_PORT_t *const port, const uint8_t pin)
+{
+	// bring the chip state up to date
+	hi3593_sim_process();
+
+	if(port != XMC_GPIO_PORT2)  return 0;
+
+	switch(pin)
+	{
+		case HI3593_MB11_PIN   : return hi3593_sim.rx[0].mailbox_full[0] ? 1 : 0;
+		case HI3593_MB12_PIN   : return hi3593_sim.rx[0].mailbox_full[1] ? 1 : 0;
+		case HI3593_MB13_PIN   : return hi3593_sim.rx[0].mailbox_full[2] ? 1 : 0;
+		case HI3593_MB21_PIN   : return hi3593_sim.rx[1].mailbox_full[0] ? 1 : 0;
+		case HI3593_MB22_PIN   : return hi3593_sim.rx[1].mailbox_full[1] ? 1 : 0;
+		case HI3593_MB23_PIN   : return hi3593_sim.rx[1].mailbox_full[2] ? 1 : 0;
+
+		case HI3593_R1FLAG_PIN : return hi3593_sim_flag_pin(&(hi3593_sim.rx[0]), hi3593_sim.flag_irq >> 0);
+		case HI3593_R2FLAG_PIN : return hi3593_sim_flag_pin(&(hi3593_sim.rx[1]), hi3593_sim.flag_irq >> 4);
+
+		case HI3593_TEMPTY_PIN : return (hi3593_sim.tx.fifo_count == 0                    ) ? 1 : 0;
+		case HI3593_TFULL_PIN  : return (hi3593_sim.tx.fifo_count == HI3593_SIM_FIFO_DEPTH) ? 1 : 0;
+
+		// the interrupt outputs only pulse, a polled level is always low
+		default                : return 0;
+	}
+}
+
+
+/****************************************************************************/
+/* task & tick functions                                                    */
+/****************************************************************************/
+
+void hi3593_tick(void)
+{
+	// the LEDs are not modeled, just consume the pulses
+	hi3593.led_flicker_state_rx.counter = 0;
+	hi3593.led_flicker_state_tx.counter = 0;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
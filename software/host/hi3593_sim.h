@@ -0,0 +1,157 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * hi3593_sim.h: Software model of the HI-3593 ARINC429 IC for host builds
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef HI3593_SIM_H
+#define HI3593_SIM_H
+
+// the model implements the driver interface of src/hi3593.h
+#include "hi3593.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/****************************************************************************/
+/* DEFINES                                                                  */
+/****************************************************************************/
+
+#define HI3593_SIM_FIFO_DEPTH          32          // depth of the RX and TX FIFOs                       ** given by hardware **
+#define HI3593_SIM_RX_CHANNELS_NUM     2           // number of receivers                                ** given by hardware **
+
+#define HI3593_SIM_BIT_TIME_HS_NS      10000       // bit time at high speed (100  kbit/s)               ** given by A429 standard **
+#define HI3593_SIM_BIT_TIME_LS_NS      80000       // bit time at  low speed (12.5 kbit/s)               ** given by A429 standard **
+#define HI3593_SIM_GAP_BITS_MIN        4           // minimum gap between two words [bit times]          ** given by A429 standard **
+
+#define HI3593_SIM_SPI_OVERHEAD_NS     5000        // default fixed cost of one SPI transaction          ## customizable ##
+#define HI3593_SIM_LOOP_NS             20000       // default cost of one main loop pass outside the task ## customizable ##
+
+
+/****************************************************************************/
+/* DATA STRUCTURES                                                          */
+/****************************************************************************/
+
+// receiver
+typedef struct
+{
+	// chip registers
+	uint8_t         ctrl;                                   // receive control register
+	uint8_t         label_filter[32];                       // label filter memory, byte 0 bit 7 = label 0xFF
+	uint8_t         priority_match[3];                      // priority label match values, [0] = match register #1
+	uint32_t        mailbox[3];                             // priority label mail boxes (bits 9 - 32)
+	bool            mailbox_full[3];                        // mail box holds an unread word
+	uint32_t        fifo[HI3593_SIM_FIFO_DEPTH];            // receive FIFO
+	uint8_t         fifo_tail;                              // index of the oldest word
+	uint8_t         fifo_count;                             // number of words in the FIFO
+
+	// traffic source on the bus
+	const uint32_t *source_frame;                           // frames sent cyclically by the simulated LRU
+	uint16_t        source_frames_num;                      // number of frames in the list
+	uint16_t        source_index;                           // next frame to send
+	uint8_t         source_speed;                           // ARINC429_SPEED_HS / _LS
+	uint8_t         source_gap_bits;                        // gap between two words [bit times]
+	uint32_t        source_parity_error_interval;           // every n-th word has a parity error, 0 = none
+	uint64_t        source_next_ns;                         // completion time of the next word on the bus
+	bool            source_active;                          // traffic source running
+
+	// interrupt wiring
+	bool            int_disconnected;                       // RxINT is not wired to the host, it has to poll the FIFO
+
+	// statistics
+	uint32_t        words_on_bus;                           // words seen on the bus
+	uint32_t        words_stored;                           // words stored in FIFO or mail box
+	uint32_t        words_rejected;                         // words rejected by label/SD filter or wrong speed
+	uint32_t        words_overwritten;                      // words lost by the FIFO overflow behavior
+	uint32_t        words_read;                             // words read by the host
+	uint8_t         fifo_high_water;                        // max. FIFO fill level
+}
+HI3593SimRX;
+
+
+// transmitter
+typedef struct
+{
+	// chip registers
+	uint8_t         ctrl;                                   // transmit control register
+	uint32_t        fifo[HI3593_SIM_FIFO_DEPTH];            // transmit FIFO
+	uint8_t         fifo_tail;                              // index of the oldest word
+	uint8_t         fifo_count;                             // number of words in the FIFO
+
+	// transmit shift register
+	bool            shifting;                               // a word is on the bus
+	uint32_t        shift_frame;                            // word on the bus
+	uint64_t        shift_done_ns;                          // completion time of the word on the bus
+
+	// bus wiring
+	uint8_t         loopback;                               // bit n set: TX bus is wired to receiver n+1
+
+	// statistics
+	uint32_t        words_written;                          // words loaded into the FIFO
+	uint32_t        words_ignored;                          // words ignored because the FIFO was full
+	uint32_t        words_transmitted;                      // words sent on the bus
+}
+HI3593SimTX;
+
+
+// complete chip and its environment
+typedef struct
+{
+	// simulated time
+	uint64_t        time_ns;                                // simulated time since start
+
+	// chip registers
+	uint8_t         flag_irq;                               // flag / interrupt assignment register
+	uint8_t         aclk_div;                               // ACLK division register
+
+	// channels
+	HI3593SimRX     rx[HI3593_SIM_RX_CHANNELS_NUM];
+	HI3593SimTX     tx;
+
+	// SPI cost model
+	uint32_t        spi_overhead_ns;                        // fixed cost per transaction
+	uint32_t        spi_byte_ns;                            // cost per byte
+
+	// SPI statistics
+	uint32_t        spi_transactions;                       // number of transactions
+	uint64_t        spi_bytes;                              // number of bytes incl. opcode
+	uint64_t        spi_time_ns;                            // time spent on the SPI bus
+}
+HI3593Sim;
+
+
+/****************************************************************************/
+/* PROTOTYPES                                                               */
+/****************************************************************************/
+
+extern HI3593Sim hi3593_sim;
+
+void     hi3593_sim_init              (void);
+void     hi3593_sim_advance_ns        (const uint64_t ns);
+uint32_t hi3593_sim_add_parity        (const uint32_t frame);
+
+void     hi3593_sim_set_rx_source     (const uint8_t rx, const uint32_t *frame, const uint16_t frames_num, const uint8_t speed, const uint8_t gap_bits);
+void     hi3593_sim_stop_rx_source    (const uint8_t rx);
+void     hi3593_sim_set_parity_errors (const uint8_t rx, const uint32_t interval);
+void     hi3593_sim_set_loopback      (const uint8_t rx_mask);
+void     hi3593_sim_disconnect_rx_int (const uint8_t rx, const bool disconnected);
+
+#endif  // HI3593_SIM_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
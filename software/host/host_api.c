@@ -0,0 +1,398 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * host_api.c: Bricklet API calls for host programs, in the style of the bindings
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "host_api.h"
+#include "host_platform.h"
+
+#include "communication.h"
+
+#include <string.h>
+
+
+/****************************************************************************/
+/* local helper functions                                                   */
+/****************************************************************************/
+
+/* response buffer shared by all calls */
+static uint8_t api_response[TFP_MESSAGE_MAX_LENGTH];
+
+/* send a request and check the reply */
+static bool api_call(void *message, const uint8_t length, const uint8_t fid)
+{
+	memset(api_response, 0, sizeof(api_response));
+
+	switch(host_request(message, length, fid, api_response))
+	{
+		case HANDLE_MESSAGE_RESPONSE_EMPTY       : /* FALLTHROUGH */
+		case HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE : return true;
+		default                                  : return false;
+	}
+}
+
+
+/****************************************************************************/
+/* API calls                                                                */
+/****************************************************************************/
+
+bool api_restart(void)
+{
+	Restart message;
+
+	return api_call(&message, sizeof(message), FID_RESTART);
+}
+
+bool api_set_channel_configuration(const uint8_t channel, const uint8_t parity, const uint8_t speed)
+{
+	SetChannelConfiguration message = {.channel = channel, .parity = parity, .speed = speed};
+
+	return api_call(&message, sizeof(message), FID_SET_CHANNEL_CONFIGURATION);
+}
+
+bool api_set_channel_mode(const uint8_t channel, const uint8_t mode)
+{
+	SetChannelMode message = {.channel = channel, .mode = mode};
+
+	return api_call(&message, sizeof(message), FID_SET_CHANNEL_MODE);
+}
+
+bool api_set_heartbeat_callback_configuration(const uint8_t channel, const bool enabled, const bool value_has_to_change, const uint16_t period)
+{
+	SetHeartbeatCallbackConfiguration message = {.channel = channel, .enabled = enabled, .value_has_to_change = value_has_to_change, .period = period};
+
+	return api_call(&message, sizeof(message), FID_SET_HEARTBEAT_CALLBACK_CONFIGURATION);
+}
+
+bool api_set_heartbeat_format(const uint8_t channel, const uint8_t format)
+{
+	SetHeartbeatFormat message = {.channel = channel, .format = format};
+
+	return api_call(&message, sizeof(message), FID_SET_HEARTBEAT_FORMAT);
+}
+
+bool api_set_rx_callback_configuration(const uint8_t channel, const bool enabled, const bool value_has_to_change, const uint16_t timeout)
+{
+	SetRXCallbackConfiguration message = {.channel = channel, .enabled = enabled, .value_has_to_change = value_has_to_change, .timeout = timeout};
+
+	return api_call(&message, sizeof(message), FID_SET_RECEIVE_CALLBACK_CONFIGURATION);
+}
+
+bool api_set_rx_standard_filters(const uint8_t channel)
+{
+	SetRXStandardFilters message = {.channel = channel};
+
+	return api_call(&message, sizeof(message), FID_SET_RX_STANDARD_FILTERS);
+}
+
+bool api_set_rx_filter(const uint8_t channel, const uint8_t label, const uint8_t sdi)
+{
+	SetRXFilter message = {.channel = channel, .label = label, .sdi = sdi};
+
+	if(!api_call(&message, sizeof(message), FID_SET_RX_FILTER))  return false;
+
+	return ((SetRXFilter_Response *)api_response)->success;
+}
+
+bool api_set_rx_filter_timeout(const uint8_t channel, const uint8_t label, const uint8_t sdi, const uint16_t timeout)
+{
+	SetRXFilterTimeout message = {.channel = channel, .label = label, .sdi = sdi, .timeout = timeout};
+
+	if(!api_call(&message, sizeof(message), FID_SET_RX_FILTER_TIMEOUT))  return false;
+
+	return ((SetRXFilterTimeout_Response *)api_response)->success;
+}
+
+bool api_set_rx_filter_statistics(const uint8_t channel, const uint8_t label, const uint8_t sdi, const bool enabled)
+{
+	SetRXFilterStatistics message = {.channel = channel, .label = label, .sdi = sdi, .enabled = enabled};
+
+	if(!api_call(&message, sizeof(message), FID_SET_RX_FILTER_STATISTICS))  return false;
+
+	return ((SetRXFilterStatistics_Response *)api_response)->success;
+}
+
+bool api_get_rx_filter_histogram(const uint8_t channel, const uint8_t label, const uint8_t sdi, uint16_t *bucket)
+{
+	GetRXFilterHistogram message = {.channel = channel, .label = label, .sdi = sdi};
+
+	if(!api_call(&message, sizeof(message), FID_GET_RX_FILTER_HISTOGRAM))  return false;
+
+	memcpy(bucket, ((GetRXFilterHistogram_Response *)api_response)->bucket, sizeof(uint16_t) * ARINC429_HISTOGRAM_SIZE);
+
+	return ((GetRXFilterHistogram_Response *)api_response)->success;
+}
+
+bool api_read_rx_statistics(const uint8_t channel, uint16_t *ext_label, uint32_t *frames, uint16_t *interval_min, uint16_t *interval_max, uint16_t *interval_mean, uint16_t *timeouts, uint16_t *entries_read)
+{
+	ReadRXStatisticsLowLevel           message  = {.channel = channel};
+	ReadRXStatisticsLowLevel_Response *response = (ReadRXStatisticsLowLevel_Response *)api_response;
+	uint16_t                           offset   = 0;
+
+	do
+	{
+		if(!api_call(&message, sizeof(message), FID_READ_RX_STATISTICS_LOW_LEVEL))  return false;
+
+		// chunks out of sync
+		if(response->entries_chunk_offset != offset)  return false;
+
+		for(uint8_t i = 0; (i < ARINC429_STATS_CHUNK_SIZE) && (offset < response->entries_length); i++, offset++)
+		{
+			ext_label    [offset] = response->ext_label_chunk_data    [i];
+			frames       [offset] = response->frames_chunk_data       [i];
+			interval_min [offset] = response->interval_min_chunk_data [i];
+			interval_max [offset] = response->interval_max_chunk_data [i];
+			interval_mean[offset] = response->interval_mean_chunk_data[i];
+			timeouts     [offset] = response->timeouts_chunk_data     [i];
+		}
+	}
+	while(offset < response->entries_length);
+
+	*entries_read = offset;
+
+	return true;
+}
+
+bool api_read_frame(const uint8_t channel, const uint8_t label, const uint8_t sdi, bool *status, uint32_t *frame, uint16_t *age)
+{
+	ReadFrame message = {.channel = channel, .label = label, .sdi = sdi};
+
+	if(!api_call(&message, sizeof(message), FID_READ_FRAME))  return false;
+
+	*status = ((ReadFrame_Response *)api_response)->status;
+	*frame  = ((ReadFrame_Response *)api_response)->frame;
+	*age    = ((ReadFrame_Response *)api_response)->age;
+
+	return true;
+}
+
+/* assembles the chunks of one frame table stream like the bindings do */
+static bool api_read_frame_table_stream(const uint8_t channel, const uint8_t fid, uint16_t *ext_label, uint8_t *status, uint32_t *frame, uint16_t *age, uint16_t *entries_read)
+{
+	ReadFrameTableLowLevel           message  = {.channel = channel};
+	ReadFrameTableLowLevel_Response *response = (ReadFrameTableLowLevel_Response *)api_response;
+	uint16_t                         offset   = 0;
+
+	do
+	{
+		if(!api_call(&message, sizeof(message), fid))  return false;
+
+		// chunks out of sync
+		if(response->entries_chunk_offset != offset)  return false;
+
+		for(uint8_t i = 0; (i < ARINC429_TABLE_CHUNK_SIZE) && (offset < response->entries_length); i++, offset++)
+		{
+			ext_label[offset] = response->ext_label_chunk_data[i];
+			status   [offset] = response->status_chunk_data   [i];
+			frame    [offset] = response->frame_chunk_data    [i];
+			age      [offset] = response->age_chunk_data      [i];
+		}
+	}
+	while(offset < response->entries_length);
+
+	*entries_read = offset;
+
+	return true;
+}
+
+/* high-level read-out of the frame table */
+bool api_read_frame_table(const uint8_t channel, uint16_t *ext_label, uint8_t *status, uint32_t *frame, uint16_t *age, uint16_t *entries_read)
+{
+	return api_read_frame_table_stream(channel, FID_READ_FRAME_TABLE_LOW_LEVEL, ext_label, status, frame, age, entries_read);
+}
+
+/* high-level read-out of the changed frame table entries */
+bool api_read_frame_delta(const uint8_t channel, uint16_t *ext_label, uint8_t *status, uint32_t *frame, uint16_t *age, uint16_t *entries_read)
+{
+	return api_read_frame_table_stream(channel, FID_READ_FRAME_DELTA_LOW_LEVEL, ext_label, status, frame, age, entries_read);
+}
+
+/* high-level read-out of the capture ring, assembles the chunks of one stream like the bindings do */
+bool api_read_capture(const uint16_t length, uint32_t *frame, uint32_t *timestamp, uint8_t *channel, uint16_t *frames_read)
+{
+	ReadCaptureLowLevel           message  = {.length = length};
+	ReadCaptureLowLevel_Response *response = (ReadCaptureLowLevel_Response *)api_response;
+	uint16_t                      offset   = 0;
+
+	do
+	{
+		if(!api_call(&message, sizeof(message), FID_READ_CAPTURE_LOW_LEVEL))  return false;
+
+		// chunks out of sync
+		if(response->frames_chunk_offset != offset)  return false;
+
+		for(uint8_t i = 0; (i < ARINC429_CAPTURE_CHUNK_SIZE) && (offset < response->frames_length); i++, offset++)
+		{
+			frame    [offset] = response->frame_chunk_data    [i];
+			timestamp[offset] = response->timestamp_chunk_data[i];
+			channel  [offset] = response->channel_chunk_data  [i];
+		}
+	}
+	while(offset < response->frames_length);
+
+	*frames_read = offset;
+
+	return true;
+}
+
+bool api_get_performance_counters(GetPerformanceCounters_Response *counters)
+{
+	GetPerformanceCounters message;
+
+	if(!api_call(&message, sizeof(message), FID_GET_PERFORMANCE_COUNTERS))  return false;
+
+	memcpy(counters, api_response, sizeof(GetPerformanceCounters_Response));
+
+	return true;
+}
+
+bool api_set_rx_overflow_configuration(const uint8_t channel, const bool enabled)
+{
+	SetRXOverflowConfiguration message = {.channel = channel, .enabled = enabled};
+
+	return api_call(&message, sizeof(message), FID_SET_RX_OVERFLOW_CONFIGURATION);
+}
+
+bool api_get_rx_fifo_overflows(const uint8_t channel, uint32_t *overflows, bool *fifo_full)
+{
+	GetRXFIFOOverflows message = {.channel = channel};
+
+	if(!api_call(&message, sizeof(message), FID_GET_RX_FIFO_OVERFLOWS))  return false;
+
+	*overflows = ((GetRXFIFOOverflows_Response *)api_response)->overflows;
+	*fifo_full = ((GetRXFIFOOverflows_Response *)api_response)->fifo_full;
+
+	return true;
+}
+
+bool api_write_frame_direct(const uint8_t channel, const uint32_t frame)
+{
+	WriteFrameDirect message = {.channel = channel, .frame = frame};
+
+	return api_call(&message, sizeof(message), FID_WRITE_FRAME_DIRECT);
+}
+
+bool api_write_frames_direct(const uint8_t channel, const uint32_t *frame, const uint8_t frames_num, uint8_t *frames_accepted, uint8_t *credits)
+{
+	WriteFramesDirect message = {.channel = channel, .frames_length = frames_num};
+
+	memcpy(message.frame, frame, frames_num * sizeof(uint32_t));
+
+	if(!api_call(&message, sizeof(message), FID_WRITE_FRAMES_DIRECT))  return false;
+
+	*frames_accepted = ((WriteFramesDirect_Response *)api_response)->frames_accepted;
+	*credits         = ((WriteFramesDirect_Response *)api_response)->credits;
+
+	return true;
+}
+
+bool api_set_tx_credit_configuration(const uint8_t channel, const bool enabled, const uint8_t watermark)
+{
+	SetTXCreditConfiguration message = {.channel = channel, .enabled = enabled, .watermark = watermark};
+
+	return api_call(&message, sizeof(message), FID_SET_TX_CREDIT_CONFIGURATION);
+}
+
+bool api_write_frame_scheduled(const uint8_t channel, const uint16_t frame_index, const uint32_t frame)
+{
+	WriteFrameScheduled message = {.channel = channel, .frame_index = frame_index, .frame = frame};
+
+	return api_call(&message, sizeof(message), FID_WRITE_FRAME_SCHEDULED);
+}
+
+bool api_set_schedule_entry(const uint8_t channel, const uint16_t job_index, const uint8_t job, const uint16_t frame_index, const uint8_t dwell_time)
+{
+	SetScheduleEntry message = {.channel = channel, .job_index = job_index, .job = job, .frame_index = frame_index, .dwell_time = dwell_time};
+
+	return api_call(&message, sizeof(message), FID_SET_SCHEDULE_ENTRY);
+}
+
+bool api_get_schedule_entry(const uint8_t channel, const uint16_t job_index, uint8_t *job, uint16_t *frame_index, uint8_t *dwell_time)
+{
+	GetScheduleEntry message = {.channel = channel, .job_index = job_index};
+
+	if(!api_call(&message, sizeof(message), FID_GET_SCHEDULE_ENTRY))  return false;
+
+	*job         = ((GetScheduleEntry_Response *)api_response)->job;
+	*frame_index = ((GetScheduleEntry_Response *)api_response)->frame_index;
+	*dwell_time  = ((GetScheduleEntry_Response *)api_response)->dwell_time;
+
+	return true;
+}
+
+bool api_stage_schedule_entry(const uint8_t channel, const uint16_t job_index, const uint8_t job, const uint16_t frame_index, const uint8_t dwell_time, uint8_t *status)
+{
+	StageScheduleEntry message = {.channel = channel, .job_index = job_index, .job = job, .frame_index = frame_index, .dwell_time = dwell_time};
+
+	if(!api_call(&message, sizeof(message), FID_STAGE_SCHEDULE_ENTRY))  return false;
+
+	*status = ((StageScheduleEntry_Response *)api_response)->status;
+
+	return true;
+}
+
+bool api_commit_schedule(const uint8_t channel, const uint8_t action)
+{
+	CommitSchedule message = {.channel = channel, .action = action};
+
+	return api_call(&message, sizeof(message), FID_COMMIT_SCHEDULE);
+}
+
+bool api_get_schedule_commit_status(const uint8_t channel, uint8_t *entries_staged, bool *commit_pending)
+{
+	GetScheduleCommitStatus message = {.channel = channel};
+
+	if(!api_call(&message, sizeof(message), FID_GET_SCHEDULE_COMMIT_STATUS))  return false;
+
+	*entries_staged = ((GetScheduleCommitStatus_Response *)api_response)->entries_staged;
+	*commit_pending = ((GetScheduleCommitStatus_Response *)api_response)->commit_pending;
+
+	return true;
+}
+
+bool api_set_schedule_time_base(const uint8_t channel, const uint16_t dwell_unit)
+{
+	SetScheduleTimeBase message = {.channel = channel, .dwell_unit = dwell_unit};
+
+	return api_call(&message, sizeof(message), FID_SET_SCHEDULE_TIME_BASE);
+}
+
+bool api_set_rx_priority_configuration(const uint8_t channel, const uint8_t mode, const uint8_t label1, const uint8_t label2, const uint8_t label3)
+{
+	SetRXPriorityConfiguration message = {.channel = channel, .mode = mode, .label = {label1, label2, label3}};
+
+	return api_call(&message, sizeof(message), FID_SET_RX_PRIORITY_CONFIGURATION);
+}
+
+bool api_set_rx_batch_configuration(const uint8_t channel, const bool enabled)
+{
+	SetRXBatchConfiguration message = {.channel = channel, .enabled = enabled};
+
+	return api_call(&message, sizeof(message), FID_SET_RX_BATCH_CONFIGURATION);
+}
+
+bool api_set_rx_batch_coalescing(const uint8_t channel, const uint8_t min_frames, const uint8_t max_latency)
+{
+	SetRXBatchCoalescing message = {.channel = channel, .min_frames = min_frames, .max_latency = max_latency};
+
+	return api_call(&message, sizeof(message), FID_SET_RX_BATCH_COALESCING);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
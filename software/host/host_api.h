@@ -0,0 +1,67 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * host_api.h: Bricklet API calls for host programs, in the style of the bindings
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef HOST_API_H
+#define HOST_API_H
+
+#include "communication.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// all functions return true if the request was accepted by the firmware
+bool api_restart                             (void);
+bool api_set_channel_configuration           (const uint8_t channel, const uint8_t parity, const uint8_t speed);
+bool api_set_channel_mode                    (const uint8_t channel, const uint8_t mode);
+bool api_set_heartbeat_callback_configuration(const uint8_t channel, const bool enabled, const bool value_has_to_change, const uint16_t period);
+bool api_set_heartbeat_format                (const uint8_t channel, const uint8_t format);
+bool api_set_rx_callback_configuration       (const uint8_t channel, const bool enabled, const bool value_has_to_change, const uint16_t timeout);
+bool api_set_rx_standard_filters             (const uint8_t channel);
+bool api_set_rx_filter                       (const uint8_t channel, const uint8_t label, const uint8_t sdi);
+bool api_set_rx_filter_timeout               (const uint8_t channel, const uint8_t label, const uint8_t sdi, const uint16_t timeout);
+bool api_set_rx_filter_statistics            (const uint8_t channel, const uint8_t label, const uint8_t sdi, const bool enabled);
+bool api_get_rx_filter_histogram             (const uint8_t channel, const uint8_t label, const uint8_t sdi, uint16_t *bucket);
+bool api_read_rx_statistics                  (const uint8_t channel, uint16_t *ext_label, uint32_t *frames, uint16_t *interval_min, uint16_t *interval_max, uint16_t *interval_mean, uint16_t *timeouts, uint16_t *entries_read);
+bool api_read_frame                          (const uint8_t channel, const uint8_t label, const uint8_t sdi, bool *status, uint32_t *frame, uint16_t *age);
+bool api_read_frame_table                    (const uint8_t channel, uint16_t *ext_label, uint8_t *status, uint32_t *frame, uint16_t *age, uint16_t *entries_read);
+bool api_read_frame_delta                    (const uint8_t channel, uint16_t *ext_label, uint8_t *status, uint32_t *frame, uint16_t *age, uint16_t *entries_read);
+bool api_read_capture                        (const uint16_t length, uint32_t *frame, uint32_t *timestamp, uint8_t *channel, uint16_t *frames_read);
+bool api_get_performance_counters            (GetPerformanceCounters_Response *counters);
+bool api_set_rx_overflow_configuration       (const uint8_t channel, const bool enabled);
+bool api_get_rx_fifo_overflows               (const uint8_t channel, uint32_t *overflows, bool *fifo_full);
+bool api_write_frame_direct                  (const uint8_t channel, const uint32_t frame);
+bool api_write_frames_direct                 (const uint8_t channel, const uint32_t *frame, const uint8_t frames_num, uint8_t *frames_accepted, uint8_t *credits);
+bool api_set_tx_credit_configuration         (const uint8_t channel, const bool enabled, const uint8_t watermark);
+bool api_write_frame_scheduled               (const uint8_t channel, const uint16_t frame_index, const uint32_t frame);
+bool api_set_schedule_entry                  (const uint8_t channel, const uint16_t job_index, const uint8_t job, const uint16_t frame_index, const uint8_t dwell_time);
+bool api_get_schedule_entry                  (const uint8_t channel, const uint16_t job_index, uint8_t *job, uint16_t *frame_index, uint8_t *dwell_time);
+bool api_stage_schedule_entry                (const uint8_t channel, const uint16_t job_index, const uint8_t job, const uint16_t frame_index, const uint8_t dwell_time, uint8_t *status);
+bool api_commit_schedule                     (const uint8_t channel, const uint8_t action);
+bool api_get_schedule_commit_status          (const uint8_t channel, uint8_t *entries_staged, bool *commit_pending);
+bool api_set_schedule_time_base              (const uint8_t channel, const uint16_t dwell_unit);
+bool api_set_rx_priority_configuration       (const uint8_t channel, const uint8_t mode, const uint8_t label1, const uint8_t label2, const uint8_t label3);
+bool api_set_rx_batch_configuration          (const uint8_t channel, const bool enabled);
+bool api_set_rx_batch_coalescing             (const uint8_t channel, const uint8_t min_frames, const uint8_t max_latency);
+
+#endif  // HOST_API_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -0,0 +1,271 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * host_platform.c: Host replacements for main() and the bricklib2 runtime
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/* The firmware sources are compiled unchanged. This file provides what they
+ * expect from bricklib2 and main(): a cooperative task (ucontext based), the
+ * system timer (derived from the simulated clock of the HI-3593 model) and
+ * the SPITFP link to the master (messages are counted and handed over to an
+ * optional consumer).
+ */
+
+#define _GNU_SOURCE
+
+#include "host_platform.h"
+#include "hi3593_sim.h"
+
+#include "arinc429.h"
+#include "communication.h"
+
+#include "bricklib2/os/coop_task.h"
+#include "bricklib2/hal/system_timer/system_timer.h"
+#include "bricklib2/protocols/tfp/tfp.h"
+#include "bricklib2/utility/communication_callback.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#define HOST_COOP_TASK_STACK_SIZE  (256 * 1024)
+#define HOST_UID                   0x00429429
+
+extern CoopTask arinc429_task;
+
+
+/****************************************************************************/
+/* data structures                                                          */
+/****************************************************************************/
+
+HostPlatform      host_platform;
+BootloaderStatus  bootloader_status;
+XMC_GPIO_PORT_t   host_gpio_port[5] = {{0}, {1}, {2}, {3}, {4}};
+
+static ucontext_t host_main_context;
+static CoopTask  *host_current_task;
+
+
+/****************************************************************************/
+/* cooperative task                                                         */
+/****************************************************************************/
+
+static void coop_task_entry(void)
+{
+	host_current_task->function();
+
+	// a task function must never return
+	fprintf(stderr, "coop task returned\n");
+	exit(1);
+}
+
+void coop_task_init(CoopTask *task, CoopTaskFunction function)
+{
+	ucontext_t *context = malloc(sizeof(ucontext_t));
+
+	task->function = function;
+	task->context  = context;
+	task->stack    = malloc(HOST_COOP_TASK_STACK_SIZE);
+
+	getcontext(context);
+	context->uc_stack.ss_sp   = task->stack;
+	context->uc_stack.ss_size = HOST_COOP_TASK_STACK_SIZE;
+	context->uc_link          = NULL;
+	makecontext(context, coop_task_entry, 0);
+}
+
+void coop_task_tick(CoopTask *task)
+{
+	host_current_task = task;
+	swapcontext(&host_main_context, (ucontext_t *)task->context);
+	host_current_task = NULL;
+}
+
+void coop_task_yield(void)
+{
+	swapcontext((ucontext_t *)host_current_task->context, &host_main_context);
+}
+
+void coop_task_sleep_ms(const uint32_t sleep)
+{
+	const uint32_t start = system_timer_get_ms();
+
+	while(!system_timer_is_time_elapsed_ms(start, sleep))
+	{
+		coop_task_yield();
+	}
+}
+
+
+/****************************************************************************/
+/* system timer                                                             */
+/****************************************************************************/
+
+uint32_t system_timer_get_ms(void)
+{
+	return (uint32_t)(hi3593_sim.time_ns / 1000000);
+}
+
+bool system_timer_is_time_elapsed_ms(const uint32_t start_measurement, const uint32_t time_to_be_elapsed)
+{
+	return (uint32_t)(system_timer_get_ms() - start_measurement) >= time_to_be_elapsed;
+}
+
+
+/****************************************************************************/
+/* TFP / SPITFP                                                             */
+/****************************************************************************/
+
+void tfp_make_default_header(TFPMessageHeader *header, const uint32_t uid, const uint8_t length, const uint8_t fid)
+{
+	memset(header, 0, sizeof(TFPMessageHeader));
+
+	header->uid    = uid;
+	header->length = length;
+	header->fid    = fid;
+}
+
+uint8_t tfp_get_fid_from_message(const void *message)
+{
+	return ((const TFPMessageHeader *)message)->fid;
+}
+
+void bootloader_tick(void)
+{
+}
+
+uint32_t bootloader_get_uid(void)
+{
+	return HOST_UID;
+}
+
+bool bootloader_spitfp_is_send_possible(SPITFP *st)
+{
+	if(host_platform.link_blocked)  return false;
+
+	return hi3593_sim.time_ns >= st->busy_until_ns;
+}
+
+void bootloader_spitfp_send_ack_and_message(BootloaderStatus *status, uint8_t *data, const uint8_t length)
+{
+	status->st.busy_until_ns = hi3593_sim.time_ns + host_platform.send_time_ns;
+
+	host_platform.messages_sent++;
+	host_platform.messages_by_fid[((TFPMessageHeader *)data)->fid]++;
+
+	if(host_platform.message_handler != NULL)  host_platform.message_handler(data, length);
+}
+
+
+/****************************************************************************/
+/* callback dispatcher                                                      */
+/****************************************************************************/
+
+static bool (*const host_callback_handler[COMMUNICATION_CALLBACK_HANDLER_NUM])(void) = {COMMUNICATION_CALLBACK_LIST_INIT};
+
+void communication_callback_init(void)
+{
+}
+
+void communication_callback_tick(void)
+{
+	static uint32_t last_time = 0;
+	static uint8_t  index     = 0;
+
+	// like on the Bricklet, at most one callback is sent every COMMUNICATION_CALLBACK_TICK_WAIT_MS
+	if(!system_timer_is_time_elapsed_ms(last_time, COMMUNICATION_CALLBACK_TICK_WAIT_MS))  return;
+
+	for(uint8_t i = 0; i < COMMUNICATION_CALLBACK_HANDLER_NUM; i++)
+	{
+		const bool sent = host_callback_handler[index]();
+
+		if(++index >= COMMUNICATION_CALLBACK_HANDLER_NUM)  index = 0;
+
+		if(sent)
+		{
+			last_time = system_timer_get_ms();
+			break;
+		}
+	}
+}
+
+
+/****************************************************************************/
+/* main()                                                                   */
+/****************************************************************************/
+
+/* everything main() does before entering the main loop */
+void host_firmware_init(void)
+{
+	memset(&host_platform, 0, sizeof(HostPlatform));
+	memset(&bootloader_status, 0, sizeof(BootloaderStatus));
+
+	host_platform.loop_ns = HI3593_SIM_LOOP_NS;
+
+	hi3593_sim_init();
+
+	// initialize communication
+	communication_init();
+
+	// initialize A429 task
+	coop_task_init(&arinc429_task, arinc429_tick_task);
+
+	// set initial system requests
+	arinc429.system.change_request = 0xFF;  // request all updates
+}
+
+/* one pass of the main loop */
+void host_firmware_loop(void)
+{
+	// do housekeeping
+	bootloader_tick();
+
+	// do communication
+	communication_tick();
+
+	// do A429 specific operations
+	arinc429_tick();
+
+	// account for the time spent outside of the SPI transfers
+	hi3593_sim_advance_ns(host_platform.loop_ns);
+
+	host_platform.loop_iterations++;
+}
+
+/* run the main loop for the given simulated time */
+void host_firmware_run_ms(const uint32_t duration)
+{
+	const uint64_t end_ns = hi3593_sim.time_ns + (uint64_t)duration * 1000000;
+
+	while(hi3593_sim.time_ns < end_ns)
+	{
+		host_firmware_loop();
+	}
+}
+
+/* hand a request over to the message dispatcher, like the bootloader does */
+BootloaderHandleMessageResponse host_request(void *message, const uint8_t length, const uint8_t fid, void *response)
+{
+	tfp_make_default_header((TFPMessageHeader *)message, HOST_UID, length, fid);
+
+	return handle_message(message, response);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -0,0 +1,68 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * host_platform.h: Host replacements for main() and the bricklib2 runtime
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include "bricklib2/bootloader/bootloader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/****************************************************************************/
+/* DATA STRUCTURES                                                          */
+/****************************************************************************/
+
+// host side of the SPITFP link and of the main loop
+typedef struct
+{
+	// main loop
+	uint32_t  loop_ns;                                      // simulated cost of bootloader_tick() + communication_tick()
+	uint64_t  loop_iterations;                              // number of main loop passes
+
+	// SPITFP link to the master
+	uint32_t  send_time_ns;                                 // the link is busy for this time after each message
+	bool      link_blocked;                                 // the master does not accept any messages
+	uint32_t  messages_sent;                                // number of messages sent to the master
+	uint32_t  messages_by_fid[256];                         // number of messages sent per function ID
+
+	// optional consumer of the messages sent to the master
+	void    (*message_handler)(const uint8_t *data, const uint8_t length);
+}
+HostPlatform;
+
+
+/****************************************************************************/
+/* PROTOTYPES                                                               */
+/****************************************************************************/
+
+extern HostPlatform host_platform;
+
+void                            host_firmware_init  (void);
+void                            host_firmware_loop  (void);
+void                            host_firmware_run_ms(const uint32_t duration);
+BootloaderHandleMessageResponse host_request        (void *message, const uint8_t length, const uint8_t fid, void *response);
+
+#endif  // HOST_PLATFORM_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
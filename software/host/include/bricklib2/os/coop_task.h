@@ -0,0 +1,45 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * coop_task.h: Host stand-in for the bricklib2 cooperative task (ucontext based)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef COOP_TASK_H
+#define COOP_TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef void (*CoopTaskFunction)(void);
+
+typedef struct
+{
+	CoopTaskFunction  function;      // task entry function
+	void             *context;       // host execution context (ucontext_t)
+	void             *stack;         // host stack of the task
+}
+CoopTask;
+
+void coop_task_init    (CoopTask *task, CoopTaskFunction function);
+void coop_task_tick    (CoopTask *task);
+void coop_task_yield   (void);
+void coop_task_sleep_ms(const uint32_t sleep);
+
+#endif  // COOP_TASK_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
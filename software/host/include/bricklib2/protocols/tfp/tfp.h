@@ -0,0 +1,48 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * tfp.h: Host stand-in for the bricklib2 TFP protocol definitions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef TFP_H
+#define TFP_H
+
+#include <stdint.h>
+
+#define TFP_MESSAGE_MIN_LENGTH  8
+#define TFP_MESSAGE_MAX_LENGTH  80
+
+typedef struct
+{
+	uint32_t uid;
+	uint8_t  length;
+	uint8_t  fid;
+	uint8_t  other_options   : 2;
+	uint8_t  authentication  : 1;
+	uint8_t  return_expected : 1;
+	uint8_t  sequence_num    : 4;
+	uint8_t  future_use      : 6;
+	uint8_t  error           : 2;
+} __attribute__((__packed__)) TFPMessageHeader;
+
+void    tfp_make_default_header  (TFPMessageHeader *header, const uint32_t uid, const uint8_t length, const uint8_t fid);
+uint8_t tfp_get_fid_from_message (const void *message);
+
+#endif  // TFP_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -0,0 +1,44 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * led_flicker.h: Host stand-in for the bricklib2 LED flicker utility
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef LED_FLICKER_H
+#define LED_FLICKER_H
+
+#include <stdint.h>
+
+#include "bricklib2/hal/system_timer/system_timer.h"
+
+#define LED_FLICKER_CONFIG_OFF        0
+#define LED_FLICKER_CONFIG_ON         1
+#define LED_FLICKER_CONFIG_HEARTBEAT  2
+#define LED_FLICKER_CONFIG_STATUS     3
+
+typedef struct
+{
+	uint32_t config;
+	uint32_t counter;
+	uint32_t start;
+}
+LEDFlickerState;
+
+#endif  // LED_FLICKER_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
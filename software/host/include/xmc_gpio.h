@@ -0,0 +1,47 @@
+/* arinc429-bricklet
+ * Copyright (C) 2026 Olaf Lüke <olaf@tinkerforge.com>
+ *
+ * xmc_gpio.h: Host stand-in for the XMC GPIO driver
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef XMC_GPIO_H
+#define XMC_GPIO_H
+
+#include <stdint.h>
+
+// on the host a port is only an identifier, the pin levels come from the HI-3593 model
+typedef struct
+{
+	uint8_t index;
+}
+XMC_GPIO_PORT_t;
+
+extern XMC_GPIO_PORT_t host_gpio_port[5];
+
+#define XMC_GPIO_PORT0  (&host_gpio_port[0])
+#define XMC_GPIO_PORT1  (&host_gpio_port[1])
+#define XMC_GPIO_PORT2  (&host_gpio_port[2])
+#define XMC_GPIO_PORT3  (&host_gpio_port[3])
+#define XMC_GPIO_PORT4  (&host_gpio_port[4])
+
+// implemented by the HI-3593 model (hi3593_sim.c)
+uint32_t XMC_GPIO_GetInput(XMC_GPIO_PORT_t *const port, const uint8_t pin);
+
+#endif  // XMC_GPIO_H
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
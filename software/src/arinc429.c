@@ -95,6 +95,269 @@ void update_tx_buffer_map(uint8_t channel_index, uint16_t buffer_index, uint8_t
 }
 
 
+/* get the number of frames in the immediate transmit queue of a TX channel */
+uint8_t get_tx_queue_fill(uint8_t channel_index)
+{
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[channel_index]);
+
+	// the head points to the last frame enqueued, the tail to the last frame sent
+	if(channel->head >= channel->tail) return channel->head - channel->tail;
+	else                               return channel->head + ARINC429_TX_QUEUE_SIZE - channel->tail;
+}
+
+
+/* update the TX job map, it marks the used entries of the scheduler job table */
+void update_tx_job_map(uint8_t channel_index, uint16_t job_index, uint8_t task)
+{
+	// get a pointer to the map word
+	uint32_t *map = &(arinc429.tx_channel[channel_index].job_map[job_index >> 5]);
+
+	// modify the map
+	switch(task)
+	{
+		case ARINC429_SET   : *map |=  (1 << (job_index & 0x1F)); break; // set   bit
+		case ARINC429_CLEAR : *map &= ~(1 << (job_index & 0x1F)); break; // clear bit
+		default             :                                     break; // unknown task, do nothing
+	}
+
+	// done
+	return;
+}
+
+
+/* get the index of the next used scheduler job after job_index, or ARINC429_TX_JOBS_NUM if there is */
+/* none up to the end of the job table - the TX job map is searched 32 entries at a time               */
+static uint16_t get_next_tx_job(uint8_t channel_index, uint16_t job_index)
+{
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[channel_index]);
+
+	// start with the job following the given one
+	job_index++;
+
+	while(job_index < ARINC429_TX_JOBS_NUM)
+	{
+		// get the map bits of this and the remaining jobs of the map word
+		uint32_t map = channel->job_map[job_index >> 5] >> (job_index & 0x1F);
+
+		// no used job in the rest of the map word?
+		if(map == 0)
+		{
+			// yes, continue with the first job of the next map word
+			job_index = (job_index | 0x1F) + 1;
+
+			continue;
+		}
+
+		// no, locate the used job
+		while(!(map & 1))
+		{
+			map >>= 1;
+			job_index++;
+		}
+
+		return job_index;
+	}
+
+	// no used job left
+	return ARINC429_TX_JOBS_NUM;
+}
+
+
+/* move the staged entries into the scheduler job table */
+void apply_staged_schedule(uint8_t channel_index)
+{
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[channel_index]);
+
+	// do all staged entries
+	for(uint8_t k = 0; k < channel->staged_used; k++)
+	{
+		uint16_t j        = channel->staged_index[k];
+		bool     was_used = (channel->job_frame[j]    & ARINC429_TX_JOB_JOBCODE_MASK) != (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS);
+		bool     is_used  = (channel->staged_frame[k] & ARINC429_TX_JOB_JOBCODE_MASK) != (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS);
+
+		// update the number of used task entries
+		if(!was_used &&  is_used)  channel->scheduler_jobs_used++;
+		if( was_used && !is_used)  channel->scheduler_jobs_used--;
+
+		// update the task table
+		channel->dwell_time[j] = channel->staged_dwell[k];
+		channel->job_frame [j] = channel->staged_frame[k];
+
+		// update the job map
+		update_tx_job_map(channel_index, j, is_used ? ARINC429_SET : ARINC429_CLEAR);
+	}
+
+	// the staging buffer is free again
+	channel->staged_used     = 0;
+	channel->schedule_commit = ARINC429_COMMIT_NONE;
+
+	// done
+	return;
+}
+
+
+/* get the timeout period of a RX frame buffer */
+uint16_t get_rx_timeout_period(uint8_t channel_index, uint8_t buffer_index)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// get the timeout period selector of the buffer
+	uint8_t select = (channel->timeout_select[buffer_index >> 4] >> ((buffer_index & 0x0F) << 1)) & 0x03;
+
+	// does the buffer have its own timeout period?
+	if(select)  return channel->timeout_periods[select - 1];
+	else        return channel->timeout_period;
+}
+
+
+#if ARINC429_RX_STATS_NUM > 0
+/* update the receive statistics of a RX frame buffer, if it has statistics assigned                  */
+/* age is the age of the frame received, ARINC429_RX_BUFFER_NEW for a frame without a predecessor, or */
+/* ARINC429_RX_BUFFER_TIMEOUT for a timeout                                                            */
+void update_rx_statistics(ARINC429RXChannel *channel, uint8_t buffer_index, uint16_t age)
+{
+	// search the statistics of the frame buffer
+	for(uint8_t k = 0; k < channel->stats_used; k++)
+	{
+		// get a pointer to the statistics
+		ARINC429RXStats *stats = &(channel->stats[k]);
+
+		// skip the statistics if they belong to another frame buffer
+		if(stats->buffer_index != buffer_index)  continue;
+
+		// timeout?
+		if(age == ARINC429_RX_BUFFER_TIMEOUT)
+		{
+			// yes, count the timeout
+			stats->timeouts++;
+		}
+		else
+		{
+			// no, count the frame
+			stats->frames++;
+
+			// was there a predecessor frame?
+			if(age != ARINC429_RX_BUFFER_NEW)
+			{
+				// yes, account for the interval between both frames
+				stats->intervals++;
+				stats->interval_sum += age;
+
+				if(age < stats->interval_min)  stats->interval_min = age;
+				if(age > stats->interval_max)  stats->interval_max = age;
+
+#if ARINC429_RX_STATS_HISTOGRAM
+				// sort the interval into the histogram: bucket n holds the intervals with n significant bits
+				uint8_t bucket = 0;
+
+				while((age >> bucket) && (bucket < ARINC429_RX_HISTOGRAM_NUM - 1))  bucket++;
+
+				// count the interval, saturating at the counter limit
+				if(stats->histogram[bucket] < 0xFFFF)  stats->histogram[bucket]++;
+#endif
+			}
+		}
+
+		// done, a frame buffer has statistics assigned only once
+		return;
+	}
+}
+#endif
+
+
+/* get the arrival time of the next frame in the RX FIFO */
+uint16_t pop_rx_arrival_time(uint8_t channel_index, uint16_t curr_time)
+{
+	// has the RxINT interrupt recorded an arrival time?
+	if(hi3593.rx_arrival_tail[channel_index] != hi3593.rx_arrival_head[channel_index])
+	{
+		// yes, consume it
+		return hi3593.rx_arrival_time[channel_index][(hi3593.rx_arrival_tail[channel_index])++ & (HI3593_RX_ARRIVAL_QUEUE_SIZE - 1)];
+	}
+	else
+	{
+		// no, use the current time instead
+		return curr_time;
+	}
+}
+
+
+/* restore the frame buffers of the filters after monitor mode, which used them for the capture ring */
+void restore_rx_frame_buffers(uint8_t channel_index)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// revert all frame buffers to unused state
+	for(uint16_t j = 0; j < ARINC429_RX_BUFFER_NUM; j++)
+	{
+		channel->frame_buffer[j].frame        = 0;
+		channel->frame_buffer[j].last_rx_time = 0;
+		channel->frame_buffer[j].frame_age    = ARINC429_RX_BUFFER_UNUSED;
+	}
+
+	// set the frame buffers assigned to filters to empty (the filters are not changed in monitor mode)
+	for(uint16_t ext_label = 0; ext_label < ARINC429_RX_FILTERS_NUM; ext_label++)
+	{
+		if(check_sw_filter_map(channel_index, ext_label))  channel->frame_buffer[channel->frame_filter[ext_label]].frame_age = ARINC429_RX_BUFFER_EMPTY;
+	}
+
+	// no frame buffer has changed or is armed for the timeout check
+	for(uint8_t j = 0; j < ARINC429_RX_BUFFER_NUM/32; j++)
+	{
+		channel->dirty_map    [j] = 0;
+		channel->timeout_armed[j] = 0;
+	}
+
+	channel->timeout_busy = false;
+}
+
+
+/* limit a timeout deadline to the horizon, deadline is the last time [ms] a buffer is not in timeout yet, */
+/* it must not be passed at the given time [ms]                                                           */
+uint16_t clamp_rx_timeout_deadline(uint16_t deadline, uint16_t curr_time)
+{
+	// is the deadline beyond the horizon? (periods of up to 60000 ms would look like passed deadlines in 16 bit time)
+	if((uint16_t)(deadline - curr_time) >= ARINC429_RX_TIMEOUT_HORIZON)
+	{
+		// yes, check the buffer at the horizon and take its deadline from there
+		deadline = curr_time + ARINC429_RX_TIMEOUT_HORIZON - 1;
+	}
+
+	return deadline;
+}
+
+
+/* arm the timeout check of a frame buffer that got a frame after being unused, empty or in timeout, */
+/* deadline is the last time [ms] the buffer is not in timeout yet, clamped to the horizon            */
+void arm_rx_timeout(ARINC429RXChannel *channel, uint8_t buffer_index, uint16_t deadline)
+{
+	// get the group of the buffer
+	uint8_t group = buffer_index >> 5;
+
+	// is the deadline earlier than the one of the group, or is it the first armed buffer of the group? (the subtraction is modulo 2^16)
+	if((channel->timeout_armed[group] == 0) || ((int16_t)(deadline - channel->timeout_due[group]) < 0))
+	{
+		// yes, the group gets due with this buffer
+		channel->timeout_due[group] = deadline;
+	}
+
+	// is the group being checked right now?
+	if(channel->timeout_busy && ((channel->timeout_resume >> 5) == group))
+	{
+		// yes, the check may have passed the buffer already, so take its deadline into account for the result of the check
+		if((int16_t)(deadline - channel->timeout_due_next) < 0)  channel->timeout_due_next = deadline;
+	}
+
+	// tag the buffer as being armed
+	channel->timeout_armed[group] |= (1 << (buffer_index & 0x1F));
+}
+
+
 /****************************************************************************/
 /* local functions                                                          */
 /****************************************************************************/
@@ -160,6 +423,7 @@ void arinc429_task_update_channel_config(void)
 			// reset statistics counters
 			channel->common.frames_processed_curr = channel->common.frames_processed_last = 0;
 			channel->common.frames_lost_curr      = channel->common.frames_lost_last      = 0;
+			channel->common.parity_errors_curr    = channel->common.parity_errors_last    = 0;
 		}
 
 		// update scheduler
@@ -169,13 +433,26 @@ void arinc429_task_update_channel_config(void)
 			if(channel->common.operating_mode == ARINC429_CHANNEL_MODE_RUN)
 			{
 				// yes, reset scheduler
-				channel->last_job_exec_time  = system_timer_get_ms();
+				channel->last_job_exec_time  = (channel->dwell_unit) ? hi3593_get_cycles() : system_timer_get_ms();
 				channel->last_job_dwell_time = 0;
 				channel->job_index           = ARINC429_TX_JOBS_NUM - 1;   // the job execution starts with incrementing the index
 
 				// restart sequence number from 0 (the counter is common to all TX channels)
 				channel->common.frame_seq_number = 0;
 			}
+			else if(channel->schedule_commit == ARINC429_COMMIT_PENDING)
+			{
+				// no, the schedule cycle a commit was waiting for will not end any more - apply the staged entries now
+				apply_staged_schedule(i);
+			}
+		}
+
+		// update the scheduler time base
+		if(channel->common.change_request & ARINC429_UPDATE_TIME_BASE)
+		{
+			// end the dwell time of the current job, the next job starts in the new time base
+			channel->last_job_exec_time  = (channel->dwell_unit) ? hi3593_get_cycles() : system_timer_get_ms();
+			channel->last_job_dwell_time = 0;
 		}
 
 		// update the transmit control register
@@ -200,7 +477,7 @@ void arinc429_task_update_channel_config(void)
 			               | (speed         << 0);   // line speed
 
 			// write control register value to A429 chip and check for success
-			hi3593_write_register(reg_tx_ctrl[i], &ctrl, opcode_length[reg_tx_ctrl[i]]); // TODO handle SPI write failure
+			arinc429.system.spi_errors += hi3593_write_register(reg_tx_ctrl[i], &ctrl, opcode_length[reg_tx_ctrl[i]]); // TODO handle SPI write failure
 		}
 
 		// clear all request flags
@@ -212,8 +489,15 @@ void arinc429_task_update_channel_config(void)
 	const uint8_t reg_rx_read[2] = {HI3593_CMD_READ_RX1_FIFO,    HI3593_CMD_READ_RX2_FIFO   };
 	const uint8_t reg_hfilter[2] = {HI3593_CMD_WRITE_RX1_FILTER, HI3593_CMD_WRITE_RX2_FILTER};
 	const uint8_t reg_rx_ctrl[2] = {HI3593_CMD_WRITE_RX1_CTRL,   HI3593_CMD_WRITE_RX2_CTRL  };
+	const uint8_t reg_rx_prio[2] = {HI3593_CMD_WRITE_RX1_PRIO,   HI3593_CMD_WRITE_RX2_PRIO  };
 	const uint8_t disc_qempty[2] = {HI3593_R1FLAG_INDEX,         HI3593_R2FLAG_INDEX        };
 
+	// RX priority label mail box opcodes and discretes
+	const uint8_t reg_mb_read [2][3] = {{HI3593_CMD_READ_RX1_PRIO1, HI3593_CMD_READ_RX1_PRIO2, HI3593_CMD_READ_RX1_PRIO3},
+	                                    {HI3593_CMD_READ_RX2_PRIO1, HI3593_CMD_READ_RX2_PRIO2, HI3593_CMD_READ_RX2_PRIO3}};
+	const uint8_t disc_mb_full[2][3] = {{HI3593_MB11_INDEX,         HI3593_MB12_INDEX,         HI3593_MB13_INDEX        },
+	                                    {HI3593_MB21_INDEX,         HI3593_MB22_INDEX,         HI3593_MB23_INDEX        }};
+
 
 	// do RX channels
 	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
@@ -231,6 +515,7 @@ void arinc429_task_update_channel_config(void)
 			// yes, reset statistics counters
 			channel->common.frames_processed_curr = channel->common.frames_processed_last = 0;
 			channel->common.frames_lost_curr      = channel->common.frames_lost_last      = 0;
+			channel->common.parity_errors_curr    = channel->common.parity_errors_last    = 0;
 		}
 
 		// reset the frame callback sequence number if the callback is set to 'off'
@@ -241,6 +526,32 @@ void arinc429_task_update_channel_config(void)
 			channel->common.frame_seq_number = 0;
 		}
 
+		// operating mode changed (or repeated set)?
+		if(channel->common.change_request & ARINC429_UPDATE_OPERATING_MODE)
+		{
+			// yes, changed to 'monitor'?
+			if(channel->common.operating_mode == ARINC429_CHANNEL_MODE_MONITOR)
+			{
+				// yes, discard all captured frames, the frame buffers hold the capture ring from now on
+				channel->capture_tail   = channel->capture_head;
+				channel->capture_active = true;
+
+				// abort a read-out stream in progress
+				arinc429.capture.frames_lost   = 0;
+				arinc429.capture.stream_length = 0;
+				arinc429.capture.stream_offset = 0;
+			}
+			else if(channel->capture_active)
+			{
+				// no, monitor mode left - drop the captured frames and restore the frame buffers from the filters
+				channel->capture_tail = channel->capture_head;
+
+				restore_rx_frame_buffers(i);
+
+				channel->capture_active = false;
+			}
+		}
+
 		// reset the frame buffers if operating mode is changed (or repeated set) to 'active'
 		if(    (channel->common.change_request  & ARINC429_UPDATE_OPERATING_MODE)
 			&& (channel->common.operating_mode == ARINC429_CHANNEL_MODE_ACTIVE  ) )
@@ -257,32 +568,69 @@ void arinc429_task_update_channel_config(void)
 			}
 		}
 
+
 		// update the FIFO hardware filter
 		if(channel->common.change_request & ARINC429_UPDATE_FIFO_FILTER)
 		{
 			// load the hardware filter bitmap into the A429 chip
-			hi3593_write_register(reg_hfilter[i], channel->hardware_filter, opcode_length[reg_hfilter[i]]);
+			arinc429.system.spi_errors += hi3593_write_register(reg_hfilter[i], channel->hardware_filter, opcode_length[reg_hfilter[i]]);
+		}
+
+		// update the priority label match registers
+		if(channel->common.change_request & ARINC429_UPDATE_PRIORITY)
+		{
+			// the chip expects the match value for mail box #3 first and for mail box #1 last
+			uint8_t match[3] = {channel->priority_label[2], channel->priority_label[1], channel->priority_label[0]};
+
+			// load the match values into the A429 chip
+			arinc429.system.spi_errors += hi3593_write_register(reg_rx_prio[i], match, opcode_length[reg_rx_prio[i]]);  // TODO handle SPI write failure
 		}
 
 		// update the receive control register
-		if(channel->common.change_request & ARINC429_UPDATE_SPEED_PARITY)
+		if(    (channel->common.change_request & ARINC429_UPDATE_SPEED_PARITY  )
+		    || (channel->common.change_request & ARINC429_UPDATE_PRIORITY      )
+		    || (channel->common.change_request & ARINC429_UPDATE_OPERATING_MODE) )
 		{
 			// isolate parity and speed
 			uint8_t parity = (channel->common.parity_speed & 0xF0) ? 1 : 0;
 			uint8_t speed  = (channel->common.parity_speed & 0x0F) ? 1 : 0;
 
+			// monitor mode? (all labels pass into the FIFO, the label filter and the mail boxes are bypassed)
+			uint8_t filter = (channel->common.operating_mode == ARINC429_CHANNEL_MODE_MONITOR) ? 0 : 1;
+
+			// priority label mail boxes in use?
+			uint8_t prio   = (channel->priority_mode == ARINC429_PRIORITY_ENABLED) ? filter : 0;
+
 			// yes, set up new control register value
 			uint8_t ctrl =   (ARINC429_FLIP << 7)    // flip label bits
 			               | (0             << 6)    // SD9 bit filter value
 			               | (0             << 5)    // SD8 bit filter value
 			               | (0             << 4)    // SD  bit filter disabled
 			               | (parity        << 3)    // parity mode
-			               | (1             << 2)    // enable hardware label filtering
-			               | (0             << 1)    // priority buffers not used
+			               | (filter        << 2)    // hardware label filtering
+			               | (prio          << 1)    // priority label mail boxes
 			               | (speed         << 0);   // line speed
 
 			// write control register value to A429 chip
-			hi3593_write_register(reg_rx_ctrl[i], &ctrl, opcode_length[reg_rx_ctrl[i]]); // TODO handle SPI write failure
+			arinc429.system.spi_errors += hi3593_write_register(reg_rx_ctrl[i], &ctrl, opcode_length[reg_rx_ctrl[i]]); // TODO handle SPI write failure
+		}
+
+		// empty the priority label mail boxes on a change of their configuration
+		if(channel->common.change_request & ARINC429_UPDATE_PRIORITY)
+		{
+			uint8_t tmp[3];   // target for dummy reads
+
+			for(uint8_t k = 0; k < 3; k++)
+			{
+				// read the mail box if it holds a stale frame
+				if(XMC_GPIO_GetInput(hi3593_input_ports[disc_mb_full[i][k]], hi3593_input_pins[disc_mb_full[i][k]]))
+				{
+					arinc429.system.spi_errors += hi3593_read_register(reg_mb_read[i][k], tmp, opcode_length[reg_mb_read[i][k]]);
+				}
+
+				// drop its arrival time
+				hi3593.rx_mailbox_full[i][k] = false;
+			}
 		}
 
 		// drain FIFO buffer on parity/speed change or mode change
@@ -298,8 +646,11 @@ void arinc429_task_update_channel_config(void)
 				if(XMC_GPIO_GetInput(hi3593_input_ports[disc_qempty[i]], hi3593_input_pins[disc_qempty[i]]) == 0) break;
 
 				// read from RX FIFO
-				hi3593_read_register(reg_rx_read[i], tmp, opcode_length[reg_rx_read[i]]);
+				arinc429.system.spi_errors += hi3593_read_register(reg_rx_read[i], tmp, opcode_length[reg_rx_read[i]]);
 			}
+
+			// drop the arrival times of the discarded frames
+			hi3593.rx_arrival_tail[i] = hi3593.rx_arrival_head[i];
 		}
 
 		// clear all request flags
@@ -311,12 +662,77 @@ void arinc429_task_update_channel_config(void)
 }
 
 
+/* get the number of frames the TX FIFO of the A429 chip can take right now
+ *
+ * The estimate of the FIFO fill level is brought up to date on the way: the
+ * TEMPTY and TFULL discretes give the exact level at the ends of the range, in
+ * between the frames written are assumed to leave the FIFO one word time after
+ * another. As the chip can not send faster than that, the estimate never falls
+ * below the true fill level.
+ */
+static uint8_t get_tx_fifo_room(uint8_t channel_index)
+{
+	// TX channel discretes
+	const uint8_t disc_tempty[1] = {HI3593_TEMPTY_INDEX};
+	const uint8_t disc_tfull [1] = {HI3593_TFULL_INDEX };
+
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[channel_index]);
+
+	// get the current time
+	uint32_t now = hi3593_get_cycles();
+
+	// is the FIFO empty?
+	if(XMC_GPIO_GetInput(hi3593_input_ports[disc_tempty[channel_index]], hi3593_input_pins[disc_tempty[channel_index]]))
+	{
+		// yes, restart the estimate from an empty FIFO
+		channel->fifo_fill      = 0;
+		channel->fifo_fill_time = now;
+	}
+	// is the FIFO full?
+	else if(XMC_GPIO_GetInput(hi3593_input_ports[disc_tfull[channel_index]], hi3593_input_pins[disc_tfull[channel_index]]))
+	{
+		// yes, restart the estimate from a full FIFO
+		channel->fifo_fill      = ARINC429_TX_FIFO_BUFFER_NUM;
+		channel->fifo_fill_time = now;
+	}
+	else
+	{
+		// no, get the word time at the current line speed
+		uint32_t word_time = ARINC429_TX_WORD_BITS * HI3593_CYCLES_PER_US
+		                   * (((channel->common.parity_speed & 0x0F) == ARINC429_SPEED_LS) ? ARINC429_BIT_TIME_LS : ARINC429_BIT_TIME_HS);
+
+		// number of frames sent at most since the estimate was made (the subtraction is modulo 2^32)
+		uint32_t sent = (uint32_t)(now - channel->fifo_fill_time) / word_time;
+
+		// the FIFO is not empty, so at least one frame is left
+		if(sent >= channel->fifo_fill)
+		{
+			channel->fifo_fill      = 1;
+			channel->fifo_fill_time = now;
+		}
+		else
+		{
+			channel->fifo_fill      -= sent;
+			channel->fifo_fill_time += sent * word_time;
+		}
+	}
+
+	// done
+	return ARINC429_TX_FIFO_BUFFER_NUM - channel->fifo_fill;
+}
+
+
 // send frames via the immediate TX queue
 void arinc429_task_tx_immediate(void)
 {
-	// TX channel opcodes and discretes
+	// TX channel opcodes
 	const uint8_t   reg_tx_queue[1] = {HI3593_CMD_WRITE_TX1_FIFO};
-	const uint8_t   disc_tfull[1]   = {HI3593_TFULL_INDEX};
+
+	uint8_t   frame[4];                            // frame broken down into individual bytes
+	uint8_t   data[4*ARINC429_TX_BURST_SIZE];      // transfer buffer for hi3593_write_fifo()
+	uint8_t   queued;                              // number of frames in the immediate transmit queue
+	uint8_t   burst;                               // number of frames moved into the TX FIFO in one go
 
 	// do TX channel(s)
 	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
@@ -327,37 +743,51 @@ void arinc429_task_tx_immediate(void)
 		// skip the channel if it has a pending configuration change
 		if(channel->common.change_request)  continue;
 
-		// is there a frame to be sent?
-		if(channel->tail != channel->head)
-		{
-			// yes, is the TX queue of the A429 chip able to accept a new frame?
-			if(XMC_GPIO_GetInput(hi3593_input_ports[disc_tfull[i]], hi3593_input_pins[disc_tfull[i]]) == 0)
-			{
-				uint8_t frame[4];   // frame broken down into individual bytes
-				uint8_t data[4];    // transfer buffer for hi3593_write_register()
+		// get the number of queued frames
+		queued = get_tx_queue_fill(i);
 
-				// yes, compute the next tail position
-				if(++(channel->tail) >= ARINC429_TX_QUEUE_SIZE) channel->tail = 0;
+		// has the queue drained down to the watermark? Then the credits callback is due (it is sent ahead of the callback queue)
+		if((channel->credit_state == ARINC429_CREDITS_ARMED) && (queued <= channel->credit_watermark))  channel->credit_state = ARINC429_CREDITS_DUE;
 
-				// get the frame and convert it from uint32_t to an array of uint8_t
-				memcpy(frame, &channel->queue[channel->tail], 4);
+		// skip the channel if there is no frame to be sent
+		if(queued == 0)  continue;
 
-				// reverse the byte sequence (the A429 chip wants the highest byte first)
-				data[0] = frame[3];
-				data[1] = frame[2];
-				data[2] = frame[1];
-				data[3] = frame[0];
+		// move as many frames as the TX FIFO of the A429 chip can take, limited by the burst size
+		burst = get_tx_fifo_room(i);
 
-				// enqueue the frame
-				hi3593_write_register(reg_tx_queue[i], data, opcode_length[reg_tx_queue[i]]); // TODO handle SPI write failure
+		if(burst > queued                ) burst = queued;
+		if(burst > ARINC429_TX_BURST_SIZE) burst = ARINC429_TX_BURST_SIZE;
 
-				// pulse the TX LED
-				hi3593.led_flicker_state_tx.counter += LED_PULSE_TIME;
+		// done with this channel if the TX FIFO is full
+		if(burst == 0)  continue;
 
-				// increment the statistics counter on processed frames
-				channel->common.frames_processed_curr++;
-			}
+		// collect the frames
+		for(uint8_t j = 0; j < burst; j++)
+		{
+			// compute the next tail position
+			if(++(channel->tail) >= ARINC429_TX_QUEUE_SIZE) channel->tail = 0;
+
+			// get the frame and convert it from uint32_t to an array of uint8_t
+			memcpy(frame, &channel->queue[channel->tail], 4);
+
+			// reverse the byte sequence (the A429 chip wants the highest byte first)
+			data[4*j+0] = frame[3];
+			data[4*j+1] = frame[2];
+			data[4*j+2] = frame[1];
+			data[4*j+3] = frame[0];
 		}
+
+		// write the frames back-to-back, without polling the TFULL discrete in between
+		arinc429.system.spi_errors += hi3593_write_fifo(reg_tx_queue[i], data, burst); // TODO handle SPI write failure
+
+		// update the fill level estimate
+		channel->fifo_fill += burst;
+
+		// pulse the TX LED
+		hi3593.led_flicker_state_tx.counter += LED_PULSE_TIME;
+
+		// increment the statistics counter on processed frames
+		channel->common.frames_processed_curr += burst;
 	}
 
 	// done
@@ -368,9 +798,8 @@ void arinc429_task_tx_immediate(void)
 // send frames via the scheduler
 void arinc429_task_tx_scheduled(void)
 {
-	// TX channel opcodes and discretes
+	// TX channel opcodes
 	const uint8_t reg_tx_queue[1] = {HI3593_CMD_WRITE_TX1_FIFO};
-	const uint8_t disc_tfull[1]   = {HI3593_TFULL_INDEX};
 
 	// do TX channel(s)
 	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
@@ -393,14 +822,33 @@ void arinc429_task_tx_scheduled(void)
 		if(channel->common.change_request)  continue;
 
 		// done for now if the dwell time of the last job has not yet elapsed
-		if(!system_timer_is_time_elapsed_ms(channel->last_job_exec_time, channel->last_job_dwell_time))  continue;
+		if(channel->dwell_unit == 0)
+		{
+			// time base is the millisecond system timer
+			if(!system_timer_is_time_elapsed_ms(channel->last_job_exec_time, channel->last_job_dwell_time))  continue;
+		}
+		else
+		{
+			// time base is the CPU cycle counter (the subtraction is modulo 2^32)
+			if((uint32_t)(hi3593_get_cycles() - channel->last_job_exec_time) < channel->last_job_dwell_time)  continue;
+		}
 
 		/*** execute the next job ***/
 
 next_task:
 
-		// advance to the next job
-		if(++channel->job_index >= ARINC429_TX_JOBS_NUM) channel->job_index = 0;
+		// advance to the next job, the wrap-around to the first job ends the schedule cycle (a JUMP does not, it is a subroutine call)
+		if(++channel->job_index >= ARINC429_TX_JOBS_NUM)
+		{
+			channel->job_index = 0;
+
+			// staged entries waiting for the end of the cycle?
+			if(channel->schedule_commit == ARINC429_COMMIT_PENDING)
+			{
+				// yes, swap them in, the new cycle starts with the first job right away
+				apply_staged_schedule(i);
+			}
+		}
 
 		// get the job data
 		job_frame  =           channel->job_frame [channel->job_index];
@@ -410,6 +858,14 @@ next_task:
 		jobcode = (job_frame & ARINC429_TX_JOB_JOBCODE_MASK) >> ARINC429_TX_JOB_JOBCODE_POS;
 		index   = (job_frame & ARINC429_TX_JOB_INDEX_MASK  ) >> ARINC429_TX_JOB_INDEX_POS;
 
+		// is it an unused entry?
+		if(jobcode == ARINC429_SCHEDULER_JOB_SKIP)
+		{
+			// yes, pass the whole run of unused entries at once, but stop at the table end so that the
+			// end of the schedule cycle is not jumped over (the job execution starts with incrementing the index)
+			channel->job_index = get_next_tx_job(i, channel->job_index) - 1;
+		}
+
 		// is it a stop command?
 		if(jobcode == ARINC429_SCHEDULER_JOB_STOP)
 		{
@@ -483,7 +939,7 @@ next_task:
 		if(jobcode >= ARINC429_SCHEDULER_JOB_SINGLE)
 		{
 			// yes, check if the TX hardware queue is able to take a new frame
-			if(XMC_GPIO_GetInput(hi3593_input_ports[disc_tfull[i]], hi3593_input_pins[disc_tfull[i]]) == 0)
+			if(get_tx_fifo_room(i) > 0)
 			{
 				uint8_t frame[4];  // frame broken down into individual bytes
 				uint8_t data[4];   // transfer buffer for hi3593_write_register()
@@ -534,7 +990,10 @@ next_task:
 				data[3] = frame[0];
 
 				// enqueue the frame
-				hi3593_write_register(reg_tx_queue[i], data, opcode_length[reg_tx_queue[i]]); // TODO handle SPI write failure
+				arinc429.system.spi_errors += hi3593_write_register(reg_tx_queue[i], data, opcode_length[reg_tx_queue[i]]); // TODO handle SPI write failure
+
+				// update the fill level estimate
+				channel->fifo_fill++;
 
 				// pulse the TX LED
 				hi3593.led_flicker_state_tx.counter += LED_PULSE_TIME;
@@ -572,11 +1031,11 @@ next_dwell:
 			}
 		}
 
-		// update the last job execution time (modulo 2^32 ms = ~ 50 days)
+		// update the last job execution time (modulo 2^32 ms = ~ 50 days, or 2^32 CPU cycles = ~ 89 s), the execution times stay on their nominal grid
 		channel->last_job_exec_time += channel->last_job_dwell_time;
 
-		// memorize the dwell time of this job
-		channel->last_job_dwell_time = dwell_time;
+		// memorize the dwell time of this job, converted to CPU cycles with the fine time base
+		channel->last_job_dwell_time = (channel->dwell_unit) ? dwell_time * channel->dwell_unit * HI3593_CYCLES_PER_US : dwell_time;
 	}
 
 	// done
@@ -584,23 +1043,253 @@ next_dwell:
 }
 
 
-/* scan receive buffers for new frames */
-void arinc429_task_receive_frames(void)
+/* capture a received frame in monitor mode, rx_time is its time of arrival */
+void capture_rx_frame(uint8_t channel_index, const uint8_t *data, uint16_t rx_time)
 {
-	// RX channel opcodes and discretes
-	const uint8_t spi_buffer_read[ARINC429_RX_CHANNELS_NUM] = {HI3593_CMD_READ_RX1_FIFO, HI3593_CMD_READ_RX2_FIFO};
-	const uint8_t disc_new_frame [ARINC429_RX_CHANNELS_NUM] = {HI3593_R1FLAG_INDEX,      HI3593_R2FLAG_INDEX     };
+	uint8_t   frame[4];      // frame broken down into individual bytes
+
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// get the current time
+	uint32_t curr_time = system_timer_get_ms();
+
+	// get the current head position in the capture ring
+	uint16_t next_head = channel->capture_head;
+
+	// compute the next head position
+	if(++next_head >= ARINC429_CAPTURE_SIZE) next_head = 0;
+
+	// capture ring full?
+	if(next_head == channel->capture_tail)
+	{
+		// yes, increment the counters on lost frames
+		channel->common.frames_lost_curr++;
+		arinc429.capture.frames_lost++;
+
+		// done
+		return;
+	}
+
+	// reverse the byte sequence (the A429 chip delivers the highest byte first)
+	frame[3] = data[0];
+	frame[2] = data[1];
+	frame[1] = data[2];
+	frame[0] = data[3];
+
+	// store the frame as is, a parity error shows as bit 32 set if the parity is set to auto
+	memcpy(&channel->capture.frame[next_head], frame, 4);
+
+	// store the time of arrival, extended to 32 bit (the subtraction is modulo 2^16)
+	channel->capture.timestamp[next_head] = curr_time - (uint16_t)((uint16_t)curr_time - rx_time);
+
+	// update the head position
+	channel->capture_head = next_head;
 
+	// increment the statistics counter
+	channel->common.frames_processed_curr++;
+
+	// done
+	return;
+}
+
+
+/* process a received frame, rx_time is its time of arrival */
+void process_rx_frame(uint8_t channel_index, const uint8_t *data, uint16_t rx_time)
+{
 	uint32_t  new_frame;     // buffer for received frame
 	uint16_t  new_age;       // computed age of the received frame
-	uint16_t  curr_time;     // cache  for current time
-	uint8_t   data[4];       // transfer buffer for hi3593_read_register()
 	uint8_t   frame[4];      // frame broken down into individual bytes
-	uint8_t   frame_budget;  // max number of frames read per channel within one invocation
 	uint16_t  ext_label;     // extended label code (label + SDI)
 	uint8_t   buffer_index;  // index of the frame buffer
 	uint8_t   message;       // callback message type
 
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// pulse the RX LED
+	hi3593.led_flicker_state_rx.counter += LED_PULSE_TIME;
+
+	// channel in monitor mode?
+	if(channel->common.operating_mode == ARINC429_CHANNEL_MODE_MONITOR)
+	{
+		// yes, capture the frame without any label look-up
+		capture_rx_frame(channel_index, data, rx_time);
+
+		// done
+		return;
+	}
+
+	// is the parity set to auto, i.e. shall the parity be checked?
+	if((channel->common.parity_speed & 0xF0) == (ARINC429_PARITY_AUTO << 4))
+	{
+		// yes, parity error? (the hardware parity checking sets bit 32 on parity error)
+		if(data[0] & 0x80)
+		{
+			// yes, increment the counter on parity errors
+			channel->common.parity_errors_curr++;
+
+			// skip further frame processing
+			return;
+		}
+	}
+
+	// reverse the byte sequence (the A429 chip delivers the highest byte first)
+	frame[3] = data[0];
+	frame[2] = data[1];
+	frame[1] = data[2];
+	frame[0] = data[3];
+
+	// convert the frame from an array of uint8_t to an uint32_t
+	memcpy(&new_frame, frame, 4);
+
+	// extract the extended label code (label + SDI), aka index for the frame filter table
+	ext_label = (uint16_t)(new_frame & ARINC429_RX_FRAME_EXT_LABEL_MASK);
+
+	// does the SDI/label combination have a filter assigned?
+	if(!check_sw_filter_map(channel_index, ext_label))  return;
+
+	// yes, look-up the assigned frame buffer
+	buffer_index = channel->frame_filter[ext_label];
+
+	// get a pointer to the frame buffer
+	ARINC429RXBuffer *buffer = &(channel->frame_buffer[buffer_index]);
+
+	// 1st frame ever or after a timeout?
+	if(buffer->frame_age <= ARINC429_RX_BUFFER_NEW)
+	{
+		// no, frame update
+		message = ARINC429_CALLBACK_JOB_FRAME_RX1 + channel_index;
+
+		//compute the age of the frame
+		new_age = rx_time - buffer->last_rx_time;
+
+		// limit the age to 60 sec = 60000 ms
+		if(new_age > 60000)  new_age = 60000;
+	}
+	else
+	{
+		// yes, 1st frame ever or after timeout
+		message = ARINC429_CALLBACK_JOB_NEW_RX1 + channel_index;
+
+		// set the age to the respective constant
+		new_age = ARINC429_RX_BUFFER_NEW;
+	}
+
+	// frame changed, or 1st frame ever or after a timeout?
+	if((buffer->frame != new_frame) || (buffer->frame_age > ARINC429_RX_BUFFER_NEW))
+	{
+		// yes, tag the frame buffer as changed for the delta read-out
+		channel->dirty_map[buffer_index >> 5] |= (1 << (buffer_index & 0x1F));
+	}
+
+	// shall send a callback?
+	if(    ((channel->common.callback_mode == ARINC429_CALLBACK_ON       )                                                                 )
+	    || ((channel->common.callback_mode == ARINC429_CALLBACK_ON_CHANGE) && ((buffer->frame != new_frame) || (buffer->frame_age > ARINC429_RX_BUFFER_NEW))) )
+	{
+		// yes, enqueue a new frame message, success?
+		if(!enqueue_message(message, rx_time, new_frame, new_age))
+		{
+			// no, increment counter on lost frames
+			channel->common.frames_lost_curr++;
+		}
+	}
+
+	// store the frame, its age and its receive time
+	buffer->frame        = new_frame;
+	buffer->frame_age    = new_age;
+	buffer->last_rx_time = rx_time;
+
+#if ARINC429_RX_STATS_NUM > 0
+	// update the receive statistics if there are any in use
+	if(channel->stats_used)  update_rx_statistics(channel, buffer_index, new_age);
+#endif
+
+	// is the timeout check of the buffer not armed yet?
+	if(!(channel->timeout_armed[buffer_index >> 5] & (1 << (buffer_index & 0x1F))))
+	{
+		// yes, arm it (the deadline of a buffer already armed is updated lazily when its group is checked)
+		arm_rx_timeout(channel, buffer_index, clamp_rx_timeout_deadline(rx_time + get_rx_timeout_period(channel_index, buffer_index), rx_time));
+	}
+
+	// increment the statistics counter
+	channel->common.frames_processed_curr++;
+
+	// done
+	return;
+}
+
+
+/* count a RX FIFO overflow and report it */
+static void report_rx_overflow(uint8_t channel_index, uint16_t curr_time)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// count the overflow
+	channel->fifo_overflows++;
+
+	// overflow callback enabled?
+	if(channel->overflow_callback)
+	{
+		// yes, queue the callback along with the updated counter (a lost callback is counted by enqueue_message())
+		enqueue_message(ARINC429_CALLBACK_JOB_OVERFLOW_RX1 + channel_index, curr_time, channel->fifo_overflows, 0);
+	}
+
+	// done
+	return;
+}
+
+
+/* adapt the RX frame budget of a channel to the FIFO pressure, exhausted tells */
+/* if the budget was used up with frames still pending in the FIFO              */
+static void update_rx_frame_budget(uint8_t channel_index, bool exhausted)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// budget used up?
+	if(exhausted)
+	{
+		// yes, count the event for the performance counters
+		arinc429.perf.budget_exhausted[channel_index]++;
+
+		// double the budget for the next ticks to drain the backlog
+		channel->frame_budget = (channel->frame_budget < ARINC429_RX_FRAME_BUDGET_MAX / 2) ? 2 * channel->frame_budget : ARINC429_RX_FRAME_BUDGET_MAX;
+	}
+	else
+	{
+		// no, shrink the budget step by step back to its default
+		if(channel->frame_budget > ARINC429_RX_FRAME_BUDGET)  channel->frame_budget--;
+	}
+
+	// done
+	return;
+}
+
+
+/* scan receive buffers for new frames */
+void arinc429_task_receive_frames(void)
+{
+	// RX channel opcodes and discretes
+	const uint8_t spi_buffer_read[ARINC429_RX_CHANNELS_NUM] = {HI3593_CMD_READ_RX1_FIFO,   HI3593_CMD_READ_RX2_FIFO  };
+	const uint8_t spi_status_read[ARINC429_RX_CHANNELS_NUM] = {HI3593_CMD_READ_RX1_STATUS, HI3593_CMD_READ_RX2_STATUS};
+	const uint8_t disc_new_frame [ARINC429_RX_CHANNELS_NUM] = {HI3593_R1FLAG_INDEX,        HI3593_R2FLAG_INDEX       };
+
+	// RX priority label mail box opcodes and discretes
+	const uint8_t spi_mb_read [ARINC429_RX_CHANNELS_NUM][3] = {{HI3593_CMD_READ_RX1_PRIO1, HI3593_CMD_READ_RX1_PRIO2, HI3593_CMD_READ_RX1_PRIO3},
+	                                                           {HI3593_CMD_READ_RX2_PRIO1, HI3593_CMD_READ_RX2_PRIO2, HI3593_CMD_READ_RX2_PRIO3}};
+	const uint8_t disc_mb_full[ARINC429_RX_CHANNELS_NUM][3] = {{HI3593_MB11_INDEX,         HI3593_MB12_INDEX,         HI3593_MB13_INDEX        },
+	                                                           {HI3593_MB21_INDEX,         HI3593_MB22_INDEX,         HI3593_MB23_INDEX        }};
+
+	uint16_t  curr_time;                           // cache  for current time
+	uint8_t   data[4*ARINC429_RX_BURST_SIZE];      // transfer buffer for hi3593_read_register() and hi3593_read_fifo()
+	uint8_t   status;                              // RX status register
+	uint8_t   pending;                             // number of frames announced by the RxINT interrupt
+	uint8_t   frame_budget;                        // max number of frames read per channel within one invocation
+	uint16_t  arrival_time;                        // arrival time of a mail box frame
+	bool      mailboxes;                           // priority label mail boxes in use
+
 
 	// get the current time, chopped to 16 bit
 	curr_time = (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
@@ -617,97 +1306,197 @@ void arinc429_task_receive_frames(void)
 		// skip the channel if it has a pending configuration change
 		if(channel->common.change_request)  continue;
 
-		// set the budget for the maximum number of frames to be read
-		frame_budget = ARINC429_RX_FRAME_BUDGET;
+		// priority label mail boxes in use? (they are bypassed in monitor mode)
+		mailboxes = (channel->priority_mode == ARINC429_PRIORITY_ENABLED) && (channel->common.operating_mode != ARINC429_CHANNEL_MODE_MONITOR);
 
-		while(frame_budget--)
+		// yes, service them ahead of the FIFO
+		if(mailboxes)
 		{
-			// done with this channel if it has no pending new frame (any more)
-			if(XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]) == 0)  break;
+			// the frame budget does not apply
+			for(uint8_t k = 0; k < 3; k++)
+			{
+				// skip the mail box if it is empty
+				if(XMC_GPIO_GetInput(hi3593_input_ports[disc_mb_full[i][k]], hi3593_input_pins[disc_mb_full[i][k]]) == 0)  continue;
 
-			// get the frame
-			hi3593_read_register(spi_buffer_read[i], data, opcode_length[spi_buffer_read[i]]);
+				// get bits 9 - 32 of the frame, the mail box does not store the label
+				arinc429.system.spi_errors += hi3593_read_register(spi_mb_read[i][k], data, opcode_length[spi_mb_read[i][k]]);
 
-			// pulse the RX LED
-			hi3593.led_flicker_state_rx.counter += LED_PULSE_TIME;
+				// complete the frame with the label the mail box is assigned to
+				data[3] = channel->priority_label[k];
 
-			// is the parity set to auto, i.e. shall the parity be checked?
-			if((channel->common.parity_speed & 0xF0) == (ARINC429_PARITY_AUTO << 4))
-			{
-				// yes, parity error? (the hardware parity checking sets bit 32 on parity error)
-				if(data[0] & 0x80)
-				{
-					// yes, increment the counter on lost frames
-					channel->common.frames_lost_curr++;
+				// take the arrival time the RxINT interrupt recorded for the mail box, the read has emptied it
+				arrival_time = hi3593.rx_mailbox_full[i][k] ? hi3593.rx_mailbox_time[i][k] : curr_time;
 
-					// skip further frame processing
-					continue;
-				}
+				hi3593.rx_mailbox_full[i][k] = false;
+
+				// process the frame
+				process_rx_frame(i, data, arrival_time);
 			}
+		}
+
+		// get the number of frames announced by the RxINT interrupt (the subtraction is modulo 2^8)
+		pending = hi3593.rx_arrival_head[i] - hi3593.rx_arrival_tail[i];
 
-			// reverse the byte sequence (the A429 chip delivers the highest byte first)
-			frame[3] = data[0];
-			frame[2] = data[1];
-			frame[1] = data[2];
-			frame[0] = data[3];
+		// check the FIFO for an overflow - without mail boxes the number of announced frames is its fill level,
+		// the status register is only read if that number is not conclusive
+		if(mailboxes && pending)
+		{
+			// a frame overwriting an unread mail box is announced like a FIFO frame, so the number is no fill level - ask the chip
+			arinc429.system.spi_errors += hi3593_read_register(spi_status_read[i], &status, opcode_length[spi_status_read[i]]);
+		}
+		else if(pending > ARINC429_RX_FIFO_BUFFER_NUM)
+		{
+			// more frames announced than the FIFO can hold
+			status = HI3593_RX_STATUS_FFFULL;
+		}
+		else if(   (pending == ARINC429_RX_FIFO_BUFFER_NUM)
+		        || ((pending == 0) && XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]])))
+		{
+			// FIFO full as announced or holding frames that were not announced - ask the chip
+			arinc429.system.spi_errors += hi3593_read_register(spi_status_read[i], &status, opcode_length[spi_status_read[i]]);
+		}
+		else
+		{
+			// FIFO not full
+			status = 0;
+		}
 
-			// convert the frame from an array of uint8_t to an uint32_t
-			memcpy(&new_frame, frame, 4);
+		// FIFO full?
+		if(status & HI3593_RX_STATUS_FFFULL)
+		{
+			// yes, count it as a new overflow if the FIFO was not full at the last check already
+			if(!channel->fifo_full)  report_rx_overflow(i, curr_time);
 
-			// extract the extended label code (label + SDI), aka index for the frame filter table
-			ext_label = (uint16_t)(new_frame & ARINC429_RX_FRAME_EXT_LABEL_MASK);
+			channel->fifo_full = true;
+		}
+		else
+		{
+			// no, the overflow (if any) is over
+			channel->fifo_full = false;
+		}
 
-			// does the SDI/label combination have a filter assigned?
-			if(check_sw_filter_map(i, ext_label))
-			{
-				// yes, look-up the assigned frame buffer
-				buffer_index = channel->frame_filter[ext_label];
+		// more frames announced than the FIFO can hold?
+		if(pending > ARINC429_RX_FIFO_BUFFER_NUM)
+		{
+			// yes, without mail boxes the A429 chip has overwritten frames - count them as lost
+			if(!mailboxes)  channel->common.frames_lost_curr += pending - ARINC429_RX_FIFO_BUFFER_NUM;
 
-				// get a pointer to the frame buffer
-				ARINC429RXBuffer *buffer = &(channel->frame_buffer[buffer_index]);
+			// drop the surplus time stamps
+			hi3593.rx_arrival_tail[i] += pending - ARINC429_RX_FIFO_BUFFER_NUM;
 
-				// 1st frame ever or after a timeout?
-				if(buffer->frame_age <= ARINC429_RX_BUFFER_NEW)
-				{
-					// no, frame update
-					message = ARINC429_CALLBACK_JOB_FRAME_RX1 + i;
+			pending = ARINC429_RX_FIFO_BUFFER_NUM;
+		}
 
-					//compute the age of the frame
-					new_age = curr_time - buffer->last_rx_time;
+		// any frames announced?
+		if(pending)
+		{
+			// yes, does the FIFO actually hold frames?
+			if(XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]) == 0)
+			{
+				// no, the time stamps are stale (FIFO drained or frame overwrote an unread mail box) - drop them
+				hi3593.rx_arrival_tail[i] = hi3593.rx_arrival_head[i];
 
-					// limit the age to 60 sec = 60000 ms
-					if(new_age > 60000)  new_age = 60000;
-				}
-				else
-				{
-					// yes, 1st frame ever or after timeout
-					message = ARINC429_CALLBACK_JOB_NEW_RX1 + i;
+				// done with this channel
+				continue;
+			}
 
-					// set the age to the respective constant
-					new_age = ARINC429_RX_BUFFER_NEW;
-				}
+			// yes, set the budget for the maximum number of frames to be read, limited by the size of a burst
+			frame_budget = (channel->frame_budget < ARINC429_RX_BURST_SIZE) ? channel->frame_budget : ARINC429_RX_BURST_SIZE;
 
-				// shall send a callback?
-				if(    ((channel->common.callback_mode == ARINC429_CALLBACK_ON       )                                                                 )
-				    || ((channel->common.callback_mode == ARINC429_CALLBACK_ON_CHANGE) && ((buffer->frame != new_frame) || (buffer->frame_age > ARINC429_RX_BUFFER_NEW))) )
+			// with priority labels in use a frame overwriting an unread mail box is announced like a FIFO frame,
+			// so the number of announced frames may exceed the FIFO fill level
+			if(mailboxes)
+			{
+				// read the announced frames one by one as long as the FIFO holds frames
+				while(pending && frame_budget)
 				{
-					// yes, enqueue a new frame message, success?
-					if(!enqueue_message(message, curr_time, new_frame, new_age))
+					// FIFO drained?
+					if(XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]) == 0)
 					{
-						// no, increment counter on lost frames
-						channel->common.frames_lost_curr++;
+						// yes, the remaining time stamps belong to mail box frames that overwrote unread ones - drop them
+						hi3593.rx_arrival_tail[i] = hi3593.rx_arrival_head[i];
+						break;
 					}
+
+					// get the frame
+					arinc429.system.spi_errors += hi3593_read_register(spi_buffer_read[i], data, opcode_length[spi_buffer_read[i]]);
+
+					// process the frame
+					process_rx_frame(i, data, pop_rx_arrival_time(i, curr_time));
+
+					pending--;
+					frame_budget--;
 				}
 
-				// store the frame, its age and its receive time
-				buffer->frame        = new_frame;
-				buffer->frame_age    = new_age;
-				buffer->last_rx_time = curr_time;
+				// adapt the budget, it is used up if the FIFO still holds frames
+				update_rx_frame_budget(i, (frame_budget == 0) && XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]));
+
+				// done with this channel
+				continue;
+			}
+
+			// adapt the budget, it is used up if more frames are announced than it allows to read
+			update_rx_frame_budget(i, pending > frame_budget);
+
+			// fetch the announced frames within the budget back-to-back
+			if(pending > frame_budget)  pending = frame_budget;
+
+			arinc429.system.spi_errors += hi3593_read_fifo(spi_buffer_read[i], data, pending);
 
-				// increment the statistics counter
-				channel->common.frames_processed_curr++;
+			// process the frames as a batch, each with its time of arrival
+			for(uint8_t j = 0; j < pending; j++)
+			{
+				process_rx_frame(i, &data[4*j], pop_rx_arrival_time(i, curr_time));
 			}
-		} // while(frame_budget)
+
+			// done with this channel
+			continue;
+		}
+
+		/*** no frames announced, poll the FIFO (interrupt missed or time stamps dropped) ***/
+
+		// set the budget for the maximum number of frames to be read
+		frame_budget = channel->frame_budget;
+
+		while(frame_budget--)
+		{
+			// done with this channel if it has no pending new frame (any more)
+			if(XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]) == 0)  break;
+
+			// get the frame
+			arinc429.system.spi_errors += hi3593_read_register(spi_buffer_read[i], data, opcode_length[spi_buffer_read[i]]);
+
+			// process the frame
+			process_rx_frame(i, data, pop_rx_arrival_time(i, curr_time));
+		}
+
+		// budget used up and still frames pending? (the post-decrement leaves the budget at 0xFF if it was used up)
+		if((frame_budget == 0xFF) && XMC_GPIO_GetInput(hi3593_input_ports[disc_new_frame[i]], hi3593_input_pins[disc_new_frame[i]]))
+		{
+			// yes, grow the budget for the next ticks to drain the backlog
+			update_rx_frame_budget(i, true);
+
+			// ask the FIFO for its fill level
+			arinc429.system.spi_errors += hi3593_read_register(spi_status_read[i], &status, opcode_length[spi_status_read[i]]);
+
+			// is the FIFO at least half full?
+			if(status & (HI3593_RX_STATUS_FFHALF | HI3593_RX_STATUS_FFFULL))
+			{
+				// yes, the backlog is growing - fetch a burst of frames back-to-back, without polling the RxFLAG discrete in between
+				arinc429.system.spi_errors += hi3593_read_fifo(spi_buffer_read[i], data, ARINC429_RX_BURST_SIZE);
+
+				// process the frames as a batch
+				for(uint8_t j = 0; j < ARINC429_RX_BURST_SIZE; j++)
+				{
+					process_rx_frame(i, &data[4*j], pop_rx_arrival_time(i, curr_time));
+				}
+			}
+		}
+		else
+		{
+			// no, the FIFO got drained - shrink the budget
+			update_rx_frame_budget(i, false);
+		}
 	} // for(channel)
 
 	// done
@@ -715,71 +1504,120 @@ void arinc429_task_receive_frames(void)
 }
 
 
-/* scan frame buffers for timeouts */
+/* check the frame buffers for timeouts */
 void arinc429_task_check_timeout(void)
 {
-	static uint8_t            buffer_index   = ARINC429_RX_BUFFER_NUM   - 1;  // will trigger a channel change            on the 1st run
-	static uint8_t            channel_index  = ARINC429_RX_CHANNELS_NUM - 1;  // will trigger a change to the 1st channel on the 1st run
-	static ARINC429RXChannel *channel;                                        // pointer to the current channel
-	static uint16_t           timeout_period;                                 // timeout period of the current channel
-
-	       uint16_t  curr_time;                                               // cache  for current time
-	       uint8_t   check_budget = ARINC429_TIMEOUT_CHECK_BUDGET;            // number of buffers checked per invocation
+	uint16_t  curr_time;     // cache for current time
+	uint8_t   check_budget;  // number of buffers checked per channel and invocation
+	uint8_t   group;         // group of frame buffers being checked
+	uint8_t   buffer_index;  // buffer being checked
+	uint16_t  deadline;      // deadline of the buffer being checked
 
 
 	// get the current time, chopped to 16 bit
 	curr_time = (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
 
-	while(check_budget--)
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
 	{
-		// advance to the next buffer, all buffers of the current channel done?
-		if(++buffer_index == 0)
-		{
-			// yes, advance to the next channel, wrap-around after last channel
-			if(++channel_index == ARINC429_RX_CHANNELS_NUM)  channel_index = 0;
+		// get a pointer to the channel
+		ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+		// skip the channel if it is not in active mode (no frame buffers in use in monitor mode)
+		if(channel->common.operating_mode != ARINC429_CHANNEL_MODE_ACTIVE)  continue;
+
+		// set the budget for the maximum number of buffers to be checked
+		check_budget = ARINC429_TIMEOUT_CHECK_BUDGET;
 
-			// cache a pointer to the channel
-			channel = &(arinc429.rx_channel[channel_index]);
+		// continue with the group left unfinished on the last invocation, if any
+		group = (channel->timeout_busy) ? (channel->timeout_resume >> 5) : 0;
 
-			// is the channel in passive mode?
-			if(channel->common.operating_mode == ARINC429_CHANNEL_MODE_PASSIVE)
+		for(; group < ARINC429_RX_BUFFER_NUM / 32; group++)
+		{
+			// starting with this group?
+			if(!channel->timeout_busy)
 			{
-				// yes, set the buffer index to the last buffer to trigger a channel change on the next invocation
-				buffer_index = ARINC429_RX_BUFFER_NUM  - 1;
+				// yes, skip it if it has no armed buffers
+				if(channel->timeout_armed[group] == 0)  continue;
+
+				// skip it if its deadline is not passed yet (a deadline seemingly beyond the horizon is a stale one, the group is checked then)
+				if((uint16_t)(channel->timeout_due[group] - curr_time) < ARINC429_RX_TIMEOUT_HORIZON)  continue;
 
-				// done for this time
-				return;
+				// start with the first buffer of the group, the horizon is the latest deadline the group can get
+				channel->timeout_resume   = group << 5;
+				channel->timeout_due_next = curr_time + ARINC429_RX_TIMEOUT_HORIZON - 1;
+				channel->timeout_busy     = true;
 			}
-			else
+
+			// check the armed buffers of the group
+			while(channel->timeout_busy)
 			{
-				// no, cache the channel's timeout period
-				timeout_period = channel->timeout_period;
-			}
-		}
+				// get the buffer and advance, the group is done after its last buffer
+				buffer_index = channel->timeout_resume;
 
-		// get a pointer to the current buffer
-		ARINC429RXBuffer *buffer = &(channel->frame_buffer[buffer_index]);
+				if((buffer_index & 0x1F) == 0x1F)  channel->timeout_busy = false;
+				else                               channel->timeout_resume++;
 
-		// does the buffer need to be checked, i.e. is it not unused, not empty, nor already found to be in timeout?
-		if(buffer->frame_age <= 60000)
-		{
-			// yes, is the buffer in timeout now? (the subtraction is modulo 2^16)
-			if((curr_time - buffer->last_rx_time) > timeout_period)
-			{
-				// yes, tag buffer as being in timeout
-				buffer->frame_age = ARINC429_RX_BUFFER_TIMEOUT;
+				// skip the buffer if it is not armed
+				if(!(channel->timeout_armed[group] & (1 << (buffer_index & 0x1F))))  continue;
+
+				// get a pointer to the buffer and its timeout period
+				ARINC429RXBuffer *buffer         = &(channel->frame_buffer[buffer_index]);
+				uint16_t          timeout_period = get_rx_timeout_period(i, buffer_index);
 
-				// callbacks enabled?
-				if(channel->common.callback_mode != ARINC429_CALLBACK_OFF)
+				// does the buffer still hold a frame, i.e. is it not unused, not empty, nor already in timeout?
+				if(buffer->frame_age > ARINC429_RX_BUFFER_NEW)
 				{
-					// yes, enqueue a timeout message, success?
-					if(!enqueue_message(ARINC429_CALLBACK_JOB_TIMEOUT_RX1 + channel_index, curr_time, buffer->frame, channel->timeout_period))
+					// no, the buffer was reset since it was armed - disarm it
+					channel->timeout_armed[group] &= ~(1 << (buffer_index & 0x1F));
+				}
+
+				// is the buffer in timeout now? (the subtraction is modulo 2^16)
+				else if((uint16_t)(curr_time - buffer->last_rx_time) > timeout_period)
+				{
+					// yes, tag buffer as being in timeout and as changed for the delta read-out, and disarm it
+					buffer->frame_age = ARINC429_RX_BUFFER_TIMEOUT;
+
+					channel->dirty_map    [group] |=  (1 << (buffer_index & 0x1F));
+					channel->timeout_armed[group] &= ~(1 << (buffer_index & 0x1F));
+
+#if ARINC429_RX_STATS_NUM > 0
+					// update the receive statistics if there are any in use
+					if(channel->stats_used)  update_rx_statistics(channel, buffer_index, ARINC429_RX_BUFFER_TIMEOUT);
+#endif
+
+					// callbacks enabled?
+					if(channel->common.callback_mode != ARINC429_CALLBACK_OFF)
 					{
-						// no, increment counter on lost frames
-						channel->common.frames_lost_curr++;
+						// yes, enqueue a timeout message, success?
+						if(!enqueue_message(ARINC429_CALLBACK_JOB_TIMEOUT_RX1 + i, curr_time, buffer->frame, timeout_period))
+						{
+							// no, increment counter on lost frames
+							channel->common.frames_lost_curr++;
+						}
 					}
 				}
+				else
+				{
+					// no, the buffer stays armed - take its deadline into account for the group (the subtraction is modulo 2^16)
+					deadline = clamp_rx_timeout_deadline(buffer->last_rx_time + timeout_period, curr_time);
+
+					if((int16_t)(deadline - channel->timeout_due_next) < 0)  channel->timeout_due_next = deadline;
+				}
+
+				// budget used up? then continue with the remainder of the group on the next invocation
+				if(--check_budget == 0)  break;
 			}
+
+			// group done?
+			if(!channel->timeout_busy)
+			{
+				// yes, it gets due with the earliest deadline of its remaining armed buffers
+				channel->timeout_due[group] = channel->timeout_due_next;
+			}
+
+			// done with this channel if the budget got used up
+			if(check_budget == 0)  break;
 		}
 	}
 
@@ -804,7 +1642,8 @@ void generate_heartbeat_callback_helper(ARINC429Common *common, uint8_t job)
 			{
 				// yes - check if the values have actually changed
 				if(    (common->frames_processed_curr == common->frames_processed_last)
-					&& (common->frames_lost_curr      == common->frames_lost_last     ) )
+					&& (common->frames_lost_curr      == common->frames_lost_last     )
+					&& (common->parity_errors_curr    == common->parity_errors_last   ) )
 				{
 					// no change, done
 					return;
@@ -814,6 +1653,7 @@ void generate_heartbeat_callback_helper(ARINC429Common *common, uint8_t job)
 					// yes, update last statistics counters with the current values
 					common->frames_processed_last = common->frames_processed_curr;
 					common->frames_lost_last      = common->frames_lost_curr;
+					common->parity_errors_last    = common->parity_errors_curr;
 				}
 			}
 
@@ -867,14 +1707,14 @@ void arinc429_init_chip(void)
 	coop_task_sleep_ms(100);
 
 	// do a master reset
-	hi3593_write_register(HI3593_CMD_MASTER_RESET,   NULL,  0);     // TODO evaluate return code
+	arinc429.system.spi_errors += hi3593_write_register(HI3593_CMD_MASTER_RESET,   NULL,  0);     // TODO evaluate return code
 
 	// give the chip some time to restart
 	coop_task_sleep_ms(100);
 
 	// configure the clock divider for an applied clock signal of 1 MHz
 	data =  0x00 << 1;
-	hi3593_write_register(HI3593_CMD_WRITE_ACLK_DIV, &data, 1);     // TODO evaluate return code
+	arinc429.system.spi_errors += hi3593_write_register(HI3593_CMD_WRITE_ACLK_DIV, &data, 1);     // TODO evaluate return code
 
 	// configure the discretes
 	data =   0x0 << 6   // R2INT  pulses high on reception of a frame on channel RX2
@@ -882,7 +1722,7 @@ void arinc429_init_chip(void)
 	       | 0x0 << 2   // R1INT  pulses high on reception of a frame on channel RX1
 	       | 0x3 << 0;  // R1FLAG goes   high when the RX1 FIFO contains >= 1 frame
 
-	hi3593_write_register(HI3593_CMD_WRITE_FLAG_IRQ, &data, 1);     // TODO evaluate return code
+	arinc429.system.spi_errors += hi3593_write_register(HI3593_CMD_WRITE_FLAG_IRQ, &data, 1);     // TODO evaluate return code
 }
 
 
@@ -914,6 +1754,8 @@ void arinc429_init_data(void)
 		channel->common.parity_speed   = (ARINC429_PARITY_AUTO << 4) | (ARINC429_SPEED_LS << 0);
 		channel->common.change_request = 0xFF;                        // request update of everything
 		channel->timeout_period        = 1000;                        // frame timeout check
+		channel->common.batch_min      = 1;                           // frame batches are sent without holding frames back
+		channel->frame_budget          = ARINC429_RX_FRAME_BUDGET;    // RX FIFO polling starts with the default budget
 
 		for(uint16_t j = 0; j < ARINC429_RX_BUFFER_NUM; j++)
 		{
@@ -930,14 +1772,60 @@ void arinc429_init_data(void)
 /* task & tick functions                                                    */
 /****************************************************************************/
 
+/* close the measurement window of the performance counters */
+static void update_perf_window(void)
+{
+	ARINC429Perf *perf = &arinc429.perf;
+
+	// compute the mean time per pass of each stage
+	for(uint8_t i = 0; i < ARINC429_PERF_STAGES_NUM; i++)
+	{
+		uint32_t avg = (perf->passes) ? perf->stage_sum[i] / perf->passes / HI3593_CYCLES_PER_US : 0;
+
+		perf->stage_avg[i] = (avg < 0xFFFF) ? avg : 0xFFFF;
+		perf->stage_sum[i] = 0;
+	}
+
+	// latch the main loop rate
+	perf->loop_rate = perf->loops;
+
+	// start the next window
+	perf->loops        = 0;
+	perf->passes       = 0;
+	perf->window_start = system_timer_get_ms();
+}
+
+
+/* account for the time spent in a stage of arinc429_tick_task(), start is updated to the current time */
+static void update_perf_stage(uint8_t stage, uint32_t *start)
+{
+	uint32_t now      = hi3593_get_cycles();
+	uint32_t duration = now - *start;
+
+	arinc429.perf.stage_sum[stage] += duration;
+
+	if(duration > arinc429.perf.stage_max[stage])  arinc429.perf.stage_max[stage] = duration;
+
+	*start = now;
+}
+
+
 void arinc429_tick(void)
 {
+	// count the main loop pass
+	arinc429.perf.loops++;
+
+	// close the measurement window of the performance counters every second
+	if(system_timer_is_time_elapsed_ms(arinc429.perf.window_start, ARINC429_PERF_WINDOW))  update_perf_window();
+
 	// restart arinc429_tick_task()
 	coop_task_tick(&arinc429_task);
 }
 
 void arinc429_tick_task(void)
 {
+	uint32_t start;  // start time of the stage in progress, for the performance counters
+
 	while(true)
 	{
 		// conditionally do the system jobs
@@ -950,23 +1838,31 @@ void arinc429_tick_task(void)
 		// conditionally do the normal operation mode jobs
 		if(arinc429.system.operating_mode == ARINC429_A429_MODE_NORMAL)
 		{
+			// start the time measurement of the stages (the times include the main loop passes while the task is yielding)
+			start = hi3593_get_cycles();
+
 			// update the channel configuration
-			arinc429_task_update_channel_config();
+			arinc429_task_update_channel_config();  update_perf_stage(ARINC429_STAGE_CHANNEL_CONFIG, &start);
 
 			// do the TX operations
-			arinc429_task_tx_immediate();    // send frames via the immediate TX queue
-			arinc429_task_tx_scheduled();    // send frames via the scheduler
+			arinc429_task_tx_immediate();           update_perf_stage(ARINC429_STAGE_TX_IMMEDIATE,   &start);  // send frames via the immediate TX queue
+			arinc429_task_tx_scheduled();           update_perf_stage(ARINC429_STAGE_TX_SCHEDULED,   &start);  // send frames via the scheduler
 
 			// do the RX operations
-			arinc429_task_receive_frames();  // scan receive buffers for new frames
-			arinc429_task_check_timeout();   // scan frame   buffers for timeouts
+			arinc429_task_receive_frames();         update_perf_stage(ARINC429_STAGE_RECEIVE_FRAMES, &start);  // scan receive buffers for new frames
+			arinc429_task_check_timeout();          update_perf_stage(ARINC429_STAGE_CHECK_TIMEOUT,  &start);  // scan frame   buffers for timeouts
 
 			// operate the RX/TX LEDs
 			hi3593_tick();
 		}
 
 		// generate the heartbeats (statistics callbacks)
-		generate_heartbeat_callback();
+		start = hi3593_get_cycles();
+
+		generate_heartbeat_callback();          update_perf_stage(ARINC429_STAGE_HEARTBEAT,      &start);
+
+		// count the task pass
+		arinc429.perf.passes++;
 
 		// done for now
 		coop_task_yield();
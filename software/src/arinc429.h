@@ -36,6 +36,7 @@
 #define ARINC429_TX_CHANNELS_NUM         1                  // number of TX channels                                      ** given by hardware **
 #define ARINC429_RX_CHANNELS_NUM         2                  // number of RX channels                                      ** given by hardware **
 #define ARINC429_RX_FIFO_BUFFER_NUM     32                  // number of buffers in receive FIFO                          ** given by hardware **
+#define ARINC429_TX_FIFO_BUFFER_NUM     32                  // number of buffers in transmit FIFO                         ** given by hardware **
 #define ARINC429_CHANNEL_TOTAL_NUM      (ARINC429_TX_CHANNELS_NUM + ARINC429_RX_CHANNELS_NUM)
 
 // bricklet setup
@@ -54,8 +55,25 @@
 #define ARINC429_RX_FRAME_LABEL_MASK     0x000000FF         // mask for frame label                                       ** given by A429 standard       **
 #define ARINC429_RX_FRAME_EXT_LABEL_MASK 0x000003FF         // mask for frame label including SDI ("extended label")      ** given by A429 standard       **
 #define ARINC429_RX_TIMEOUT_SCAN_PERIOD  100                // period of RX buffer scans for timeouts [ms]                ## customizable, min 2 and even ##
+#ifndef ARINC429_RX_FRAME_BUDGET
 #define ARINC429_RX_FRAME_BUDGET         5                  // max number of frames read per channel in one tick          ## fudge factor for performance tuning (good value:  5)
-#define ARINC429_TIMEOUT_CHECK_BUDGET    10                 // number of frame buffers checked for timeout in one tick    ## fudge factor for performance tuning (goof value:  ?)
+#endif
+#ifndef ARINC429_RX_FRAME_BUDGET_MAX
+#define ARINC429_RX_FRAME_BUDGET_MAX     16                 // limit of the frame budget when it grows under FIFO pressure ## fudge factor for performance tuning, max 32 (RX FIFO depth) ##
+#endif
+#define ARINC429_RX_BURST_SIZE           16                 // number of frames read in one burst from a half full RX FIFO ** given by hardware (FFHALF)   **
+#ifndef ARINC429_TIMEOUT_CHECK_BUDGET
+#define ARINC429_TIMEOUT_CHECK_BUDGET    10                 // max number of frame buffers checked per channel in one tick ## fudge factor for performance tuning (good value: 10)
+#endif
+#define ARINC429_RX_TIMEOUTS_NUM         3                  // number of distinct per-filter timeout periods per channel  ** given by 2 bit selector per frame buffer **
+#define ARINC429_RX_TIMEOUT_HORIZON      16384              // max distance of a timeout group deadline into the future [ms], later deadlines are checked early ** given by 16 bit time **
+#ifndef ARINC429_RX_STATS_NUM
+#define ARINC429_RX_STATS_NUM            4                  // number of RX filters per channel with receive statistics, 0 = no statistics ## customizable, max 255, 24 byte each ##
+#endif
+#ifndef ARINC429_RX_STATS_HISTOGRAM
+#define ARINC429_RX_STATS_HISTOGRAM      1                  // frame age histogram with the receive statistics, 1 = yes, 0 = no ## customizable, adds 32 byte to each statistics ##
+#endif
+#define ARINC429_RX_HISTOGRAM_NUM        16                 // number of buckets of the frame age histogram (log2 spaced) ** given by API (ARINC429_HISTOGRAM_SIZE) **
 
 // TX scheduler
 #define ARINC429_TX_JOBS_NUM             1000               // number of TX jobs                                          ## customizable, max 4096       ##
@@ -64,13 +82,31 @@
 #define ARINC429_TX_JOB_INDEX_MASK       0x0FFF             // mask for frame index                                       ** given by application design  **
 #define ARINC429_TX_JOB_JOBCODE_POS      12                 // LSB position of job   code                                 ** given by application design  **
 #define ARINC429_TX_JOB_INDEX_POS        0                  // LSB position of frame index                                ** given by application design  **
+#ifndef ARINC429_TX_STAGED_NUM
+#define ARINC429_TX_STAGED_NUM           32                 // number of job table changes staged for the next schedule cycle ## customizable, max 255, use multiple of 4 for memory alignment, 5 byte each ##
+#endif
 #define ARINC429_TX_ZERO_DWELL_BUDGET    4                  // number of successive zero dwell time jobs done in one tick ## fudge factor for performance tuning (good value:  4)
+#ifndef ARINC429_TX_BURST_SIZE
+#define ARINC429_TX_BURST_SIZE           16                 // max number of frames moved from the immediate queue into the TX FIFO in one tick ## fudge factor for performance tuning, max 32 (TX FIFO depth) ##
+#endif
+#define ARINC429_TX_WORD_BITS            36                 // bit times per transmitted frame, 32 bit + 4 bit gap        ** given by A429 standard       **
+#define ARINC429_BIT_TIME_HS             10                 // bit time at high speed [us]                                ** given by A429 standard       **
+#define ARINC429_BIT_TIME_LS             80                 // bit time at  low speed [us]                                ** given by A429 standard       **
 
 // callback queue
 #define ARINC429_CB_QUEUE_SIZE           128                // number of entries in the callback queue                    ## customizable, max 2^16, use multiple of 4 for memory alignment ##
 
+// capture ring (RX monitor mode)
+#define ARINC429_CAPTURE_SIZE            ARINC429_RX_BUFFER_NUM  // number of entries in the capture ring of each RX channel ** given by the overlay with the frame buffers, 8 byte each **
+
 // immediate transmit queue
-#define ARINC429_TX_QUEUE_SIZE           16                 // number of entries in the immediate transmit queue          ## customizable, max 2^8  ##
+#ifndef ARINC429_TX_QUEUE_SIZE
+#define ARINC429_TX_QUEUE_SIZE           32                 // number of entries in the immediate transmit queue          ## customizable, max 2^8, holds one frame less ##
+#endif
+
+// performance counters
+#define ARINC429_PERF_STAGES_NUM         6                  // number of timed stages of arinc429_tick_task()             ** given by API (ARINC429_STAGES_NUM) **
+#define ARINC429_PERF_WINDOW             1000               // length of the measurement window for rates and averages [ms] ** given by application design  **
 
 // requests - system level
 #define ARINC429_SYSTEM_RESET_XMC_DATA   (1 << 0)           // request reset  of the XMC  data structure
@@ -83,10 +119,19 @@
 #define ARINC429_UPDATE_FIFO_FILTER      (1 << 1)           // request update of the FIFO filter
 #define ARINC429_UPDATE_OPERATING_MODE   (1 << 2)           // request update of operating mode
 #define ARINC429_UPDATE_CALLBACK_MODE    (1 << 3)           // request update of callback  mode
+#define ARINC429_UPDATE_PRIORITY         (1 << 4)           // request update of the priority label mail boxes
+#define ARINC429_UPDATE_TIME_BASE        (1 << 5)           // request update of the scheduler time base
 
 // internal encodings
 #define ARINC429_SET                     0                  // set   a filter in a filter map
 #define ARINC429_CLEAR                   1                  // clear a filter in a filter map
+#define ARINC429_TABLE_FULL              0                  // frame table read-out of all filters
+#define ARINC429_TABLE_DELTA             1                  // frame table read-out of the filters with a changed frame only
+#define ARINC429_CREDITS_IDLE            0                  // immediate transmit queue at or below the watermark, credits reported
+#define ARINC429_CREDITS_ARMED           1                  // immediate transmit queue filled above the watermark
+#define ARINC429_CREDITS_DUE             2                  // immediate transmit queue drained down to the watermark, credits callback due
+#define ARINC429_COMMIT_NONE             0                  // staged job table changes are collected
+#define ARINC429_COMMIT_PENDING          1                  // staged job table changes wait for the end of the schedule cycle
 
 
 /****************************************************************************/
@@ -102,8 +147,50 @@ typedef struct
 	uint16_t         timestamp[ARINC429_CB_QUEUE_SIZE];     //   256 message creation time       (ring buffer)
 	uint32_t         frame    [ARINC429_CB_QUEUE_SIZE];     //   512 frame                       (ring buffer)
 	uint16_t         age_token[ARINC429_CB_QUEUE_SIZE];     //   256 frame age [ms] or token     (ring buffer)
+	uint8_t          batch_seq_number;                      //     1 sequence number for the frame batch callback
+	uint8_t          spare1;                                //     1 unused / for alignment purpose
+	uint8_t          spare2;                                //     1 unused / for alignment purpose
+	uint8_t          spare3;                                //     1 unused / for alignment purpose
+}                                                           // =====
+PACKED ARINC429Callback;                                    // 1.160 byte
+
+
+// capture ring of a RX channel in monitor mode, overlays the frame buffers of the channel
+typedef struct
+{
+	uint32_t         frame    [ARINC429_CAPTURE_SIZE];      //  1.024 captured frame                (ring buffer)
+	uint32_t         timestamp[ARINC429_CAPTURE_SIZE];      //  1.024 time of arrival [ms]          (ring buffer)
+}                                                           //  =====
+PACKED ARINC429CaptureRing;                                 //  2.048 byte
+
+
+// read-out of the capture rings of the RX monitor mode
+typedef struct
+{
+	uint16_t         frames_lost;                           //     2 frames lost due to a full capture ring (modulo 2^16)
+	uint16_t         stream_length;                         //     2 number of frames in the read-out stream in progress
+	uint16_t         stream_offset;                         //     2 number of frames already read out of the stream
+	uint16_t         spare;                                 //     2 unused / for alignment purpose
+}                                                           // =====
+PACKED ARINC429Capture;                                     //     8 byte
+
+
+// performance counters
+typedef struct
+{
+	uint32_t         window_start;                          //     4 start time of the current measurement window [ms]
+	uint32_t         loops;                                 //     4 main loop passes in the current window
+	uint32_t         loop_rate;                             //     4 main loop passes in the last window [1/s]
+	uint32_t         passes;                                //     4 task passes in the current window
+	uint32_t         stage_sum[ARINC429_PERF_STAGES_NUM];   //    24 time spent in each stage in the current window [CPU cycles]
+	uint32_t         stage_max[ARINC429_PERF_STAGES_NUM];   //    24 longest time spent in each stage in one pass   [CPU cycles]
+	uint16_t         stage_avg[ARINC429_PERF_STAGES_NUM];   //    12 mean time spent in each stage per pass in the last window [us]
+	uint16_t         callback_high_water;                   //     2 max fill level of the callback queue
+	uint8_t          tx_queue_high_water;                   //     1 max fill level of the immediate transmit queue
+	uint8_t          spare;                                 //     1 unused / for alignment purpose
+	uint32_t         budget_exhausted[ARINC429_RX_CHANNELS_NUM]; //     8 RX frame budget used up with frames still pending, per RX channel
 }                                                           // =====
-PACKED ARINC429Callback;                                    // 1.156 byte
+PACKED ARINC429Perf;                                        //    88 byte
 
 
 // common config and status data for all channel types
@@ -116,9 +203,9 @@ typedef struct
 	uint8_t          change_request;                        //     1 pending configuration change
 
 	// frame / scheduler callback
-	uint8_t          spare1;                                //     1 unused / for alignment purpose
-	uint8_t          spare2;                                //     1 unused / for alignment purpose
-	uint8_t          spare3;                                //     1 unused / for alignment purpose
+	uint8_t          batch_mode;                            //     1 frame callbacks sent as frame batches (RX channels only)
+	uint8_t          batch_min;                             //     1 frame batches: min number of frames to be collected
+	uint8_t          batch_latency;                         //     1 frame batches: max time [ms] frames are held back
 	uint8_t          frame_seq_number;                      //     1 sequence number for the frame / scheduler message callback
 
 	// statistics callback
@@ -126,25 +213,30 @@ typedef struct
 	uint8_t          stats_mode;                            //     1 mode: off, on, on change only
 	uint16_t         stats_period;                          //     2 heartbeat period
 	uint32_t         stats_last_time;                       //     4 time when last heartbeat was sent
-	uint16_t         frames_processed_curr;                 //     2 statistics counter - processed frames - current       value
-	uint16_t         frames_processed_last;                 //     2 statistics counter - processed frames - last reported value
-	uint16_t         frames_lost_curr;                      //     2 statistics counter - dropped   frames - current       value
-	uint16_t         frames_lost_last;                      //     2 statistics counter - dropped   frames - last reported value
+	uint32_t         frames_processed_curr;                 //     4 statistics counter - processed frames - current       value
+	uint32_t         frames_processed_last;                 //     4 statistics counter - processed frames - last reported value
+	uint32_t         frames_lost_curr;                      //     4 statistics counter - dropped   frames - current       value
+	uint32_t         frames_lost_last;                      //     4 statistics counter - dropped   frames - last reported value
+	uint32_t         parity_errors_curr;                    //     4 statistics counter - parity errors     - current       value
+	uint32_t         parity_errors_last;                    //     4 statistics counter - parity errors     - last reported value
+	uint8_t          stats_format;                          //     1 heartbeat format: standard or extended
+	uint8_t          spare1;                                //     1 unused / for alignment purpose
+	uint16_t         spare2;                                //     2 unused / for alignment purpose
 }                                                           // =====
-PACKED ARINC429Common;                                      //    24 byte
+PACKED ARINC429Common;                                      //    44 byte
 
 
 // config and status of a TX channel
 typedef struct
 {
 	// common part
-	ARINC429Common   common;                                //     24 common config and status data for all channel types
+	ARINC429Common   common;                                //     44 common config and status data for all channel types
 
 	// immediate transmit
-	uint32_t         queue[ARINC429_TX_QUEUE_SIZE];         //     64 frame queue
+	uint32_t         queue[ARINC429_TX_QUEUE_SIZE];         //    128 frame queue
 	uint8_t          head;                                  //      1 frame queue head index
 	uint8_t          tail;                                  //      1 frame queue tail index
-	uint16_t         spare;                                 //      2 unused / for alignment purpose
+	uint16_t         dwell_unit;                            //      2 scheduler time base: 0 = dwell times in ms, else dwell time unit in us
 
 	// scheduled transmit
 	uint16_t         scheduler_jobs_used;                   //      2 number of used job entries
@@ -152,14 +244,32 @@ typedef struct
 	uint16_t         job_index_jump;                        //      2 index of the last jump job
 	uint8_t          spare1;                                //      1 unused / for alignment purpose
 	uint8_t          dwell_time_jump;                       //      1 dwell time of the last jump command
-	uint32_t         last_job_exec_time;                    //      4 execution time of the last job
-	uint32_t         last_job_dwell_time;                   //      4 dwell     time of the last job
+	uint32_t         last_job_exec_time;                    //      4 execution time of the last job [ms or CPU cycles, see dwell_unit]
+	uint32_t         last_job_dwell_time;                   //      4 dwell     time of the last job [ms or CPU cycles, see dwell_unit]
 	uint16_t         job_frame[ARINC429_TX_JOBS_NUM];       //  2.000 bits 15-12: action (mute, single, cyclic), bits 11-0: index frame[] table
 	uint8_t          dwell_time[ARINC429_TX_JOBS_NUM];      //  1.000 waiting time in ms before advancing to the next job
 	uint32_t         frame_buffer[ARINC429_TX_BUFFER_NUM];  //  1.024 scheduled TX frames
 	uint32_t         frame_buffer_map[8];                   //     32 single transmit status tracking
+	uint32_t         job_map[(ARINC429_TX_JOBS_NUM+31)/32]; //    128 used job entries, lets the scheduler pass runs of unused entries at once
+
+	// staged job table changes
+	uint16_t         staged_index[ARINC429_TX_STAGED_NUM];  //     64 job index of the staged entries
+	uint16_t         staged_frame[ARINC429_TX_STAGED_NUM];  //     64 job code and frame index of the staged entries
+	uint8_t          staged_dwell[ARINC429_TX_STAGED_NUM];  //     32 dwell time of the staged entries
+	uint8_t          staged_used;                           //      1 number of staged entries
+	uint8_t          schedule_commit;                       //      1 commit state: none, pending
+	uint16_t         spare4;                                //      2 unused / for alignment purpose
+
+	// transmit FIFO of the A429 chip
+	uint32_t         fifo_fill_time;                        //      4 time the fill level estimate refers to [CPU cycles]
+	uint8_t          fifo_fill;                             //      1 estimated number of frames in the transmit FIFO
+
+	// flow control of the immediate transmit queue
+	uint8_t          credit_callback;                       //      1 credits callback enabled / disabled
+	uint8_t          credit_watermark;                      //      1 credits callback when the queue fill level drops to this value
+	uint8_t          credit_state;                          //      1 credits callback state: idle, armed, due
 }                                                           //  =====
-PACKED ARINC429TXChannel;                                   //  4.164 byte
+PACKED ARINC429TXChannel;                                   //  4.548 byte
 
 
 // received frame buffer
@@ -172,18 +282,49 @@ typedef struct
 PACKED ARINC429RXBuffer;                                    //     8 byte
 
 
+#if ARINC429_RX_STATS_NUM > 0
+// receive statistics of a RX frame buffer
+typedef struct
+{
+	uint32_t         frames;                                //     4 number of frames received
+	uint32_t         intervals;                             //     4 number of intervals between two frames measured
+	uint32_t         interval_sum;                          //     4 sum of all intervals measured [ms]
+	uint16_t         interval_min;                          //     2 shortest interval [ms]
+	uint16_t         interval_max;                          //     2 longest  interval [ms]
+	uint16_t         timeouts;                              //     2 number of timeouts
+	uint16_t         ext_label;                             //     2 filter: bits 10-8 SDI (ARINC429_SDI0 .. _SDI_DATA), bits 7-0 label
+	uint8_t          buffer_index;                          //     1 frame buffer of the filter
+	uint8_t          spare1;                                //     1 unused / for alignment purpose
+	uint16_t         spare2;                                //     2 unused / for alignment purpose
+#if ARINC429_RX_STATS_HISTOGRAM
+	uint16_t         histogram[ARINC429_RX_HISTOGRAM_NUM];  //    32 number of intervals per bucket: 0 ms, 1 ms, 2-3 ms, 4-7 ms, ... >= 16384 ms (optional)
+#endif
+}                                                           // =====
+PACKED ARINC429RXStats;                                     //    24 byte (56 byte with the histogram)
+#endif
+
+
 // config and status of a RX channel
 typedef struct
 {
 	// common part
-	ARINC429Common   common;                                //     24 common config and status data for all channel types
+	ARINC429Common   common;                                //     44 common config and status data for all channel types
 
 	// timeout check
 	uint16_t         timeout_period;                        //      2 timeout time [ms]
 
-	// frame buffers
+	// frame buffers, in monitor mode they hold the capture ring instead
 	uint16_t         frame_buffers_used;                    //      2 number of used frame buffers
-	ARINC429RXBuffer frame_buffer[ARINC429_RX_BUFFER_NUM];  //  2.048 frames buffers
+	union
+	{
+		ARINC429RXBuffer    frame_buffer[ARINC429_RX_BUFFER_NUM];  //  2.048 frames buffers
+		ARINC429CaptureRing capture;                            //  2.048 capture ring (monitor mode)
+	};
+
+	// per-filter timeout periods
+	uint16_t         timeout_periods[ARINC429_RX_TIMEOUTS_NUM]; //      6 timeout periods assigned to filters [ms]
+	uint16_t         spare3;                                //      2 unused / for alignment purpose
+	uint32_t         timeout_select[ARINC429_RX_BUFFER_NUM/16]; //     64 timeout period per frame buffer, 2 bit each: 0 = timeout_period, n = timeout_periods[n-1]
 
 	// software frame filters
 	uint32_t         frame_filter_map[32];                  //    128 frame filter assignment table
@@ -191,8 +332,52 @@ typedef struct
 
 	// hardware frame filters
 	uint8_t          hardware_filter[32];                   //     32 hardware filter assignment table
+
+	// priority label mail boxes
+	uint8_t          priority_mode;                         //      1 priority label mail boxes enabled / disabled
+	uint8_t          priority_label[3];                     //      3 labels assigned to the mail boxes #1 to #3
+
+	// frame table read-out
+	uint16_t         table_length;                          //      2 number of entries in the read-out stream in progress
+	uint16_t         table_offset;                          //      2 number of entries already read out of the stream
+	uint16_t         table_ext_label;                       //      2 extended label to continue the read-out with
+	uint8_t          table_mode;                            //      1 kind of stream in progress (full table or changes only)
+	uint8_t          spare1;                                //      1 unused / for alignment purpose
+	uint32_t         dirty_map[ARINC429_RX_BUFFER_NUM/32];  //     32 frame buffers changed since their last delta read-out
+
+	// receive statistics
+#if ARINC429_RX_STATS_NUM > 0
+	ARINC429RXStats  stats[ARINC429_RX_STATS_NUM];          //    224 statistics of selected RX filters (96 without the histograms)
+	uint8_t          stats_used;                            //      1 number of statistics in use
+	uint8_t          stats_length;                          //      1 number of statistics in the read-out stream in progress
+	uint8_t          stats_offset;                          //      1 number of statistics already read out of the stream
+#else
+	uint8_t          spare4[3];                             //      3 unused / for alignment purpose
+#endif
+
+	// RX FIFO polling
+	uint8_t          frame_budget;                          //      1 max number of frames read in one tick, adapted to the FIFO pressure
+
+	// RX FIFO overflow detection
+	uint32_t         fifo_overflows;                        //      4 number of times the RX FIFO was found full
+	uint8_t          fifo_full;                             //      1 RX FIFO was full at the last check
+	uint8_t          overflow_callback;                     //      1 overflow callback enabled / disabled
+	uint16_t         spare2;                                //      2 unused / for alignment purpose
+
+	// timeout check - the frame buffers are checked in groups of 32, each group when its earliest deadline has passed
+	uint32_t         timeout_armed[ARINC429_RX_BUFFER_NUM/32]; //     32 frame buffers holding a frame that may time out
+	uint16_t         timeout_due[ARINC429_RX_BUFFER_NUM/32];   //     16 earliest deadline of the armed frame buffers of each group [ms]
+	uint16_t         timeout_due_next;                      //      2 earliest deadline found so far in the group being checked [ms]
+	uint8_t          timeout_resume;                        //      1 next frame buffer to check in the group being checked
+	uint8_t          timeout_busy;                          //      1 a group check is in progress
+
+	// capture ring (monitor mode)
+	uint16_t         capture_head;                          //      2 capture ring head index
+	uint16_t         capture_tail;                          //      2 capture ring tail index
+	uint8_t          capture_active;                        //      1 the frame buffers hold the capture ring
+	uint8_t          spare5[3];                             //      3 unused / for alignment purpose
 }                                                           //  =====
-PACKED ARINC429RXChannel;                                   //  3.260 byte
+PACKED ARINC429RXChannel;                                   //  3.692 byte (3.468 without the receive statistics)
 
 
 // system settings
@@ -202,25 +387,33 @@ typedef struct
     uint8_t           change_request;                       //      1 request  for system setting changes
     uint8_t           spare1;                               //      1 unused / for alignment purpose
     uint8_t           spare2;                               //      1 unused / for alignment purpose
+    uint32_t          queue_overflows;                      //      4 statistics counter - messages not enqueued for a full callback queue
+    uint32_t          spi_errors;                           //      4 statistics counter - failed SPI transactions with the A429 chip
 }                                                           //  =====
-PACKED ARINC429System;                                      //      4 byte
+PACKED ARINC429System;                                      //     12 byte
 
 
 // final combined data structure
 typedef struct
 {
 	// channels
-	ARINC429TXChannel tx_channel[ARINC429_TX_CHANNELS_NUM]; //  4.164 TX channels
-	ARINC429RXChannel rx_channel[ARINC429_RX_CHANNELS_NUM]; //  6.520 RX channels
+	ARINC429TXChannel tx_channel[ARINC429_TX_CHANNELS_NUM]; //  4.548 TX channels
+	ARINC429RXChannel rx_channel[ARINC429_RX_CHANNELS_NUM]; //  7.384 RX channels
 
 	// callback queue
-	ARINC429Callback  callback;                             //  1.156 callback queue
+	ARINC429Callback  callback;                             //  1.160 callback queue
+
+	// capture ring read-out
+	ARINC429Capture   capture;                              //      8 read-out of the capture rings of the RX monitor mode
+
+	// performance counters
+	ARINC429Perf      perf;                                 //     88 performance counters
 
 	// system - Attention: needs to be placed at the end
 	//                     of the ARINC429 data structure!
-	ARINC429System    system;                               //      4 system settings
+	ARINC429System    system;                               //     12 system settings
 }                                                           // ======
-PACKED ARINC429;                                            // 11.844 byte (11.6 kByte)
+PACKED ARINC429;                                            // 13.200 byte (12.9 kByte), 12.752 byte without the receive statistics
 
 
 /****************************************************************************/
@@ -233,8 +426,17 @@ void arinc429_tick(void);
 void arinc429_tick_task(void);
 
 void update_tx_buffer_map(uint8_t channel_index, uint16_t buffer_index, uint8_t task);
+void update_tx_job_map   (uint8_t channel_index, uint16_t job_index,    uint8_t task);
 bool  check_tx_buffer_map(uint8_t channel_index, uint16_t buffer_index);
 
+uint8_t get_tx_queue_fill(uint8_t channel_index);
+void    apply_staged_schedule(uint8_t channel_index);
+
+uint16_t get_rx_timeout_period(uint8_t channel_index, uint8_t buffer_index);
+#if ARINC429_RX_STATS_NUM > 0
+void     update_rx_statistics(ARINC429RXChannel *channel, uint8_t buffer_index, uint16_t age);
+#endif
+
 #endif  // ARINC429_H
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -30,6 +30,8 @@
 
 #include "xmc_gpio.h"
 
+#include <string.h>
+
 extern const int8_t opcode_length[256];
 
 
@@ -86,20 +88,58 @@ BootloaderHandleMessageResponse handle_message(const void *message, void *respon
 		case FID_GET_RX_FILTER                        : return get_rx_filter                        (message, response);
 
 		case FID_READ_FRAME                           : return read_frame                           (message, response);
+		case FID_READ_FRAME_TABLE_LOW_LEVEL           : return read_frame_table_low_level           (message, response);
+		case FID_READ_FRAME_DELTA_LOW_LEVEL           : return read_frame_delta_low_level           (message, response);
+		case FID_READ_CAPTURE_LOW_LEVEL               : return read_capture_low_level               (message, response);
 
 		case FID_SET_RECEIVE_CALLBACK_CONFIGURATION   : return set_rx_callback_configuration        (message          );
 		case FID_GET_RECEIVE_CALLBACK_CONFIGURATION   : return get_rx_callback_configuration        (message, response);
+		case FID_SET_RX_BATCH_CONFIGURATION           : return set_rx_batch_configuration           (message          );
+		case FID_GET_RX_BATCH_CONFIGURATION           : return get_rx_batch_configuration           (message, response);
+		case FID_SET_RX_BATCH_COALESCING              : return set_rx_batch_coalescing              (message          );
+		case FID_GET_RX_BATCH_COALESCING              : return get_rx_batch_coalescing              (message, response);
 
 		case FID_WRITE_FRAME_DIRECT                   : return write_frame_direct                   (message          );
+		case FID_WRITE_FRAMES_DIRECT                  : return write_frames_direct                  (message, response);
+		case FID_SET_TX_CREDIT_CONFIGURATION          : return set_tx_credit_configuration          (message          );
+		case FID_GET_TX_CREDIT_CONFIGURATION          : return get_tx_credit_configuration          (message, response);
 		case FID_WRITE_FRAME_SCHEDULED                : return write_frame_scheduled                (message          );
 		case FID_SET_FRAME_MODE                       : return set_frame_mode                       (message          );
 
 		case FID_CLEAR_SCHEDULE_ENTRIES               : return clear_schedule_entries               (message          );
 		case FID_SET_SCHEDULE_ENTRY                   : return set_schedule_entry                   (message          );
 		case FID_GET_SCHEDULE_ENTRY                   : return get_schedule_entry                   (message, response);
+		case FID_SET_SCHEDULE_TIME_BASE               : return set_schedule_time_base               (message          );
+		case FID_GET_SCHEDULE_TIME_BASE               : return get_schedule_time_base               (message, response);
+		case FID_STAGE_SCHEDULE_ENTRY                 : return stage_schedule_entry                 (message, response);
+		case FID_COMMIT_SCHEDULE                      : return commit_schedule                      (message          );
+		case FID_GET_SCHEDULE_COMMIT_STATUS           : return get_schedule_commit_status           (message, response);
 
 		case FID_RESTART                              : return restart                              (message          );
 
+		case FID_SET_RX_PRIORITY_CONFIGURATION        : return set_rx_priority_configuration        (message          );
+		case FID_GET_RX_PRIORITY_CONFIGURATION        : return get_rx_priority_configuration        (message, response);
+
+		case FID_SET_RX_FILTER_TIMEOUT                : return set_rx_filter_timeout                (message, response);
+		case FID_GET_RX_FILTER_TIMEOUT                : return get_rx_filter_timeout                (message, response);
+
+#if ARINC429_RX_STATS_NUM > 0
+		case FID_SET_RX_FILTER_STATISTICS             : return set_rx_filter_statistics             (message, response);
+		case FID_READ_RX_STATISTICS_LOW_LEVEL         : return read_rx_statistics_low_level         (message, response);
+#if ARINC429_RX_STATS_HISTOGRAM
+		case FID_GET_RX_FILTER_HISTOGRAM              : return get_rx_filter_histogram              (message, response);
+#endif
+#endif
+
+		case FID_SET_HEARTBEAT_FORMAT                 : return set_heartbeat_format                 (message          );
+		case FID_GET_HEARTBEAT_FORMAT                 : return get_heartbeat_format                 (message, response);
+
+		case FID_GET_PERFORMANCE_COUNTERS             : return get_performance_counters             (message, response);
+
+		case FID_SET_RX_OVERFLOW_CONFIGURATION        : return set_rx_overflow_configuration        (message          );
+		case FID_GET_RX_OVERFLOW_CONFIGURATION        : return get_rx_overflow_configuration        (message, response);
+		case FID_GET_RX_FIFO_OVERFLOWS                : return get_rx_fifo_overflows                (message, response);
+
 		default                                       : return HANDLE_MESSAGE_RESPONSE_NOT_SUPPORTED;
 	}
 }
@@ -134,6 +174,17 @@ static bool check_channel(const uint8_t channel, const uint8_t group)
 }
 
 
+/* check if the frame buffers of a RX channel hold the capture ring, i.e. the channel is in or just leaving */
+/* monitor mode - its filters can not be changed and its frame buffers not be read then                     */
+bool check_rx_capture_active(uint8_t channel_index)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	return (channel->common.operating_mode == ARINC429_CHANNEL_MODE_MONITOR) || channel->capture_active;
+}
+
+
 /* check the software filter map for a filter assignment */
 bool check_sw_filter_map(uint8_t channel_index, uint16_t ext_label)
 {
@@ -202,6 +253,29 @@ void update_hw_filter_map(uint8_t channel_index, uint8_t label, uint8_t task)
 }
 
 
+#if ARINC429_RX_STATS_NUM > 0
+/* remove the receive statistics of a RX frame buffer, if it has any */
+static void release_rx_statistics(uint8_t channel_index, uint8_t buffer_index)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// search the statistics of the frame buffer
+	for(uint8_t k = 0; k < channel->stats_used; k++)
+	{
+		// skip the statistics if they belong to another frame buffer
+		if(channel->stats[k].buffer_index != buffer_index)  continue;
+
+		// move the last statistics in use into the gap
+		channel->stats[k] = channel->stats[--(channel->stats_used)];
+
+		// done
+		return;
+	}
+}
+#endif
+
+
 /* clear a RX filter and free the frame buffer if applicable */
 /* helper function to clear_rx_filter()                      */
 bool clear_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
@@ -215,6 +289,9 @@ bool clear_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
 	// compute the filter index from the given SDI and label, thereby replace SDI_DATA by SDI 0
 	ext_label = ((sdi & 0x03) << 8) | label;
 
+	// abort if the frame buffers hold the capture ring
+	if(check_rx_capture_active(channel_index)) return false;
+
 	// abort if the SDI/label combination does not have a filter assigned
 	if(!check_sw_filter_map(channel_index, ext_label)) return false;
 
@@ -246,6 +323,12 @@ bool clear_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
 
 			// free the frame buffer
 			channel->frame_buffer[buffer_index].frame_age = ARINC429_RX_BUFFER_UNUSED;
+			channel->dirty_map[buffer_index >> 5]        &= ~(1 << (buffer_index & 0x1F));
+
+#if ARINC429_RX_STATS_NUM > 0
+			// drop its receive statistics
+			release_rx_statistics(channel_index, buffer_index);
+#endif
 
 			// done, filter successfully removed
 			return true;
@@ -280,6 +363,12 @@ bool clear_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
 
 			// free the frame buffer
 			channel->frame_buffer[buffer_index].frame_age = ARINC429_RX_BUFFER_UNUSED;
+			channel->dirty_map[buffer_index >> 5]        &= ~(1 << (buffer_index & 0x1F));
+
+#if ARINC429_RX_STATS_NUM > 0
+			// drop its receive statistics
+			release_rx_statistics(channel_index, buffer_index);
+#endif
 
 			// done, filter successfully removed
 			return true;
@@ -327,6 +416,9 @@ bool set_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
 {
 	uint8_t   buffer_index;
 
+	// abort if the frame buffers hold the capture ring
+	if(check_rx_capture_active(channel_index)) return false;
+
 	// abort if all frame buffers are in use already
 	if(arinc429.rx_channel[channel_index].frame_buffers_used == ARINC429_RX_BUFFER_NUM) return false;
 
@@ -340,6 +432,8 @@ bool set_rx_filter_helper(uint8_t channel_index, uint8_t label, uint8_t sdi)
 	channel->frame_buffer[buffer_index].frame        = 0;
 	channel->frame_buffer[buffer_index].frame_age    = ARINC429_RX_BUFFER_EMPTY;
 	channel->frame_buffer[buffer_index].last_rx_time = 0;
+	channel->timeout_select[buffer_index >> 4]      &= ~(0x03 << ((buffer_index & 0x0F) << 1));
+	channel->dirty_map[buffer_index >> 5]           &= ~(1 << (buffer_index & 0x1F));
 
 	// shall create a SDI_DATA filter?
 	if(sdi == ARINC429_SDI_DATA)
@@ -536,6 +630,67 @@ BootloaderHandleMessageResponse get_heartbeat_callback_configuration(const GetHe
 }
 
 
+/* select the heartbeat callback format */
+BootloaderHandleMessageResponse set_heartbeat_format(const SetHeartbeatFormat *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_ALL)    )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->format > ARINC429_HEARTBEAT_EXTENDED )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, store the new format
+			arinc429.tx_channel[i].common.stats_format = data->format;
+		}
+	}
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, store the new format
+			arinc429.rx_channel[i].common.stats_format = data->format;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get the heartbeat callback format */
+BootloaderHandleMessageResponse get_heartbeat_format(const GetHeartbeatFormat          *data,
+                                                           GetHeartbeatFormat_Response *response)
+{
+	ARINC429Common *config;
+
+	// prepare the response
+	response->header.length = sizeof(GetHeartbeatFormat_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_TX1 : config = &(arinc429.tx_channel[0].common); break;
+		case ARINC429_CHANNEL_RX1 : config = &(arinc429.rx_channel[0].common); break;
+		case ARINC429_CHANNEL_RX2 : config = &(arinc429.rx_channel[1].common); break;
+	}
+
+	// collect the response data
+	response->format = config->stats_format;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
 /* set the channel configuration */
 BootloaderHandleMessageResponse set_channel_configuration(const SetChannelConfiguration *data)
 {
@@ -605,7 +760,7 @@ BootloaderHandleMessageResponse get_channel_configuration(const GetChannelConfig
 }
 
 
-/* set the channel operating mode (passive/active/run) */
+/* set the channel operating mode (passive/active/run/monitor) */
 BootloaderHandleMessageResponse set_channel_mode(const SetChannelMode *data)
 {
 	// check the parameters, abort if invalid
@@ -635,7 +790,9 @@ BootloaderHandleMessageResponse set_channel_mode(const SetChannelMode *data)
 		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
 		{
 			// yes, check 'mode' parameter, abort if invalid
-			if(data->mode > ARINC429_CHANNEL_MODE_ACTIVE)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+			if(    (data->mode != ARINC429_CHANNEL_MODE_PASSIVE)
+			    && (data->mode != ARINC429_CHANNEL_MODE_ACTIVE )
+			    && (data->mode != ARINC429_CHANNEL_MODE_MONITOR) )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
 			// update the channel operating mode
 			arinc429.rx_channel[i].common.operating_mode = data->mode;
@@ -683,6 +840,12 @@ BootloaderHandleMessageResponse clear_all_rx_filters(const ClearAllRXLabelFilter
 	// check the channel parameter, abort if invalid
 	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
+	// abort if the frame buffers of a selected channel hold the capture ring
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		if(((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i)) && check_rx_capture_active(i))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	}
+
 	// do all RX channels
 	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
 	{
@@ -710,6 +873,17 @@ BootloaderHandleMessageResponse clear_all_rx_filters(const ClearAllRXLabelFilter
 				channel->frame_buffer[j].frame_age = ARINC429_RX_BUFFER_UNUSED;
 			}
 
+			// clear the frame buffer change tracking
+			for(uint8_t j = 0; j < ARINC429_RX_BUFFER_NUM/32; j++)
+			{
+				channel->dirty_map[j] = 0;
+			}
+
+#if ARINC429_RX_STATS_NUM > 0
+			// drop all receive statistics
+			channel->stats_used = 0;
+#endif
+
 			// no frame buffer is used any more now
 			channel->frame_buffers_used = 0;
 
@@ -771,6 +945,12 @@ BootloaderHandleMessageResponse set_rx_standard_filters(const SetRXStandardFilte
 	// check the channel parameter, abort if invalid
 	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
+	// abort if the frame buffers of a selected channel hold the capture ring
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		if(((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i)) && check_rx_capture_active(i))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	}
+
 	// do all RX channels
 	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
 	{
@@ -806,6 +986,23 @@ BootloaderHandleMessageResponse set_rx_standard_filters(const SetRXStandardFilte
 				channel->frame_buffer[j].last_rx_time = 0;
 			}
 
+			// all frame buffers use the channel timeout period
+			for(uint8_t j = 0; j < ARINC429_RX_BUFFER_NUM/16; j++)
+			{
+				channel->timeout_select[j] = 0;
+			}
+
+			// clear the frame buffer change tracking
+			for(uint8_t j = 0; j < ARINC429_RX_BUFFER_NUM/32; j++)
+			{
+				channel->dirty_map[j] = 0;
+			}
+
+#if ARINC429_RX_STATS_NUM > 0
+			// drop all receive statistics
+			channel->stats_used = 0;
+#endif
+
 			// all frame buffers are in use now
 			channel->frame_buffers_used = ARINC429_RX_BUFFER_NUM;
 
@@ -932,6 +1129,84 @@ BootloaderHandleMessageResponse get_rx_filter(const GetRXFilter          *data,
 }
 
 
+/* get the frame and its age from a RX frame buffer, returns false if the buffer has not received a frame yet */
+static bool read_rx_frame_buffer(uint8_t channel_index, uint8_t buffer_index, uint32_t *frame, uint16_t *age)
+{
+	// get a pointer to the frame buffer
+	ARINC429RXBuffer *buffer = &(arinc429.rx_channel[channel_index].frame_buffer[buffer_index]);
+
+	// report no frame while the frame buffers hold the capture ring
+	if(check_rx_capture_active(channel_index))
+	{
+		*frame = 0;
+		*age   = 0;
+		return false;
+	}
+
+	switch(buffer->frame_age)
+	{
+		case ARINC429_RX_BUFFER_EMPTY   : *frame = 0;
+		                                  *age   = 0;
+		                                  return false;
+
+		case ARINC429_RX_BUFFER_TIMEOUT : *frame = buffer->frame;
+		                                  *age   = get_rx_timeout_period(channel_index, buffer_index);
+		                                  return true;
+
+		default                         : *frame = buffer->frame;
+		                                  *age   = buffer->frame_age;
+		                                  return true;
+	}
+}
+
+
+/* find the next RX filter, starting the search at the given extended label          */
+/* returns the index of its frame buffer and updates ext_label to the filter found,     */
+/* or returns false if there is no further filter                                     */
+static bool find_next_rx_filter(uint8_t channel_index, uint16_t *ext_label, uint8_t *buffer_index)
+{
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// search the software filter map
+	for(uint16_t pos = *ext_label; pos < ARINC429_RX_FILTERS_NUM; pos++)
+	{
+		// skip the rest of the map word if it has no further filter
+		if(!(channel->frame_filter_map[pos >> 5] >> (pos & 0x1F)))  { pos |= 0x1F; continue; }
+
+		// skip the extended label if it has no filter
+		if(!check_sw_filter_map(channel_index, pos))  continue;
+
+		// get the label and the frame buffer
+		uint8_t label = pos & ARINC429_RX_FRAME_LABEL_MASK;
+		uint8_t index = channel->frame_filter[pos];
+
+		// SDI 1 to 3 sharing the frame buffer of SDI 0? (part of a SDI_DATA filter, reported with SDI 0 already)
+		if((pos >> 8) && check_sw_filter_map(channel_index, label) && (channel->frame_filter[label] == index))  continue;
+
+		// SDI 0 sharing its frame buffer with SDI 1? (SDI_DATA filter)
+		if(!(pos >> 8) && check_sw_filter_map(channel_index, (1 << 8) | label) && (channel->frame_filter[(1 << 8) | label] == index))
+		{
+			// yes, report the filter with SDI_DATA, but continue the search after SDI 0
+			*ext_label = (ARINC429_SDI_DATA << 8) | label;
+		}
+		else
+		{
+			// no, single SDI filter
+			*ext_label = pos;
+		}
+
+		// filter found
+		*buffer_index = index;
+
+		return true;
+	}
+
+	// no further filter
+	return false;
+}
+
+
 /* do a direct read of an A429 frame by channel, label and SDI */
 BootloaderHandleMessageResponse read_frame(const ReadFrame          *data,
                                                  ReadFrame_Response *response)
@@ -961,23 +1236,7 @@ BootloaderHandleMessageResponse read_frame(const ReadFrame          *data,
 		uint8_t buffer_index = channel->frame_filter[ext_label];
 
 		// collect the response data
-		switch(channel->frame_buffer[buffer_index].frame_age)
-		{
-			case ARINC429_RX_BUFFER_EMPTY   : response->status = false;
-											  response->frame  = 0;
-											  response->age    = 0;
-											  break;
-
-			case ARINC429_RX_BUFFER_TIMEOUT : response->status = true;
-											  response->frame  = channel->frame_buffer[buffer_index].frame;
-											  response->age    = channel->timeout_period;
-											  break;
-
-			default                         : response->status = true;
-											  response->frame  = channel->frame_buffer[buffer_index].frame;
-											  response->age    = channel->frame_buffer[buffer_index].frame_age;
-											  break;
-		}
+		response->status = read_rx_frame_buffer(channel_index, buffer_index, &response->frame, &response->age);
 	}
 	else
 	{
@@ -992,176 +1251,1232 @@ BootloaderHandleMessageResponse read_frame(const ReadFrame          *data,
 }
 
 
-/* set configuration of the RX frame callback */
-BootloaderHandleMessageResponse set_rx_callback_configuration(const SetRXCallbackConfiguration *data)
+/* count the frame buffers of a channel that changed since their last delta read-out */
+static uint16_t count_dirty_rx_frame_buffers(uint8_t channel_index)
 {
-	// check the parameters, abort if invalid
-	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->timeout < 10                    )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->timeout > 60000                 )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-
-	// determine the mode - step 1: on_change or not
-	uint8_t mode = (data->value_has_to_change == true) ? ARINC429_CALLBACK_ON_CHANGE : ARINC429_CALLBACK_ON;
-
-	// determine the mode - step 2: on(_change) or off
-	if(data->enabled == false)  mode = ARINC429_CALLBACK_OFF;
+	uint16_t count = 0;
 
-	// do all RX channels
-	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	// count the bits set in the map
+	for(uint8_t j = 0; j < ARINC429_RX_BUFFER_NUM/32; j++)
 	{
-		// channel selected?
-		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
-		{
-			// yes, update the channel data
-			arinc429.rx_channel[i].common.callback_mode = mode;
-			arinc429.rx_channel[i].timeout_period       = data->timeout;
-
-			// request execution of the update
-			arinc429.rx_channel[i].common.change_request |= ARINC429_UPDATE_CALLBACK_MODE;
-		}
+		for(uint32_t map = arinc429.rx_channel[channel_index].dirty_map[j]; map; map &= map - 1)  count++;
 	}
 
-	// done, no response
-	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+	return count;
 }
 
 
-/* get configuration of the RX frame callback */
-BootloaderHandleMessageResponse get_rx_callback_configuration(const GetRXCallbackConfiguration          *data,
-                                                                    GetRXCallbackConfiguration_Response *response)
+/* read the frames of the RX filters of a channel, ordered by extended label and streamed in chunks */
+/* helper function to read_frame_table_low_level() and read_frame_delta_low_level()                  */
+static BootloaderHandleMessageResponse read_frame_table_helper(uint8_t channel_selector, uint8_t mode, ReadFrameTableLowLevel_Response *response)
 {
 	ARINC429RXChannel *channel;
+	uint8_t            channel_index;
+	uint16_t           ext_label;      // extended label of the filter found
+	uint8_t            buffer_index;   // frame buffer  of the filter found
+	bool               found;          // next filter found
 
 	// prepare the response
-	response->header.length = sizeof(GetRXCallbackConfiguration_Response);
+	response->header.length = sizeof(ReadFrameTableLowLevel_Response);
 
 	// pick the selected channel
-	switch(data->channel)
+	switch(channel_selector)
 	{
 		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
-		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
-		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  channel_index = 0; break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  channel_index = 1; break;
 	}
 
-	// determine the response for 'enabled' and 'value_has_to_change'
-	switch(channel->common.callback_mode & 0x07)
+	// is the previous stream complete or was it of the other kind?
+	if((channel->table_offset >= channel->table_length) || (channel->table_mode != mode))
 	{
-		default                          : /* FALLTHROUGH */
-		case ARINC429_CALLBACK_OFF       : response->enabled = false; response->value_has_to_change = false;  break;
-		case ARINC429_CALLBACK_ON        : response->enabled = true;  response->value_has_to_change = false;  break;
-		case ARINC429_CALLBACK_ON_CHANGE : response->enabled = true;  response->value_has_to_change = true;   break;
+		// yes, start a new stream with all filters (each filter has a frame buffer of its own) or with the changed ones only
+		channel->table_length    = (mode == ARINC429_TABLE_FULL) ? channel->frame_buffers_used : count_dirty_rx_frame_buffers(channel_index);
+		channel->table_offset    = 0;
+		channel->table_ext_label = 0;
+		channel->table_mode      = mode;
 	}
 
-	// get the response for 'timeout'
-	response->timeout  = channel->timeout_period;
+	// collect the stream data
+	response->entries_length       = channel->table_length;
+	response->entries_chunk_offset = channel->table_offset;
 
-	// done, send response
-	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
-}
+	// fill the chunk
+	for(uint8_t i = 0; i < ARINC429_TABLE_CHUNK_SIZE; i++)
+	{
+		// stream complete?
+		found = (channel->table_offset < channel->table_length);
 
+		// no, search the next filter (with a changed frame buffer in case of a delta stream)
+		while(found)
+		{
+			// get the next filter, done if there is none (filters may have been cleared meanwhile)
+			if(!find_next_rx_filter(channel_index, &channel->table_ext_label, &buffer_index))  { found = false; break; }
 
-/* send a frame immediately */
-BootloaderHandleMessageResponse write_frame_direct(const WriteFrameDirect *data)
-{
-	uint8_t  next_head;  // head position in immediate transmit queue
+			// done if a full stream is read or the frame buffer has changed
+			if(    (mode == ARINC429_TABLE_FULL                                                     )
+			    || (channel->dirty_map[buffer_index >> 5] & (1 << (buffer_index & 0x1F))) )  break;
 
-	// check the channel parameter, abort if invalid
-	if(!check_channel(data->channel, GROUP_TX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+			// continue the search after the filter (the mask maps SDI_DATA filters back to their SDI 0 position)
+			channel->table_ext_label = (channel->table_ext_label & ARINC429_RX_FRAME_EXT_LABEL_MASK) + 1;
+		}
 
-	// do all TX channels
-	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
-	{
-		// channel selected?
-		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		// no filter left for this entry?
+		if(!found)
 		{
-			// get a pointer to the channel
-			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
+			// yes, clear the entry
+			response->ext_label_chunk_data[i] = 0;
+			response->status_chunk_data   [i] = 0;
+			response->frame_chunk_data    [i] = 0;
+			response->age_chunk_data      [i] = 0;
 
-			// get the current head position
-			next_head = channel->head;
+			// account for the entry if it is part of the stream
+			if(channel->table_offset < channel->table_length)  channel->table_offset++;
 
-			// compute the next head position
-			if(++next_head >= ARINC429_TX_QUEUE_SIZE) next_head = 0;
+			continue;
+		}
 
-			// is the immediate transmit queue able to accept a frame?
-			if(next_head == channel->tail)
-			{
-				// no, increment the statistics counter on lost frames
-				channel->common.frames_lost_curr++;
-			}
-			else
-			{
-				// yes, enqueue the frame
-				channel->queue[next_head] = data->frame;
+		// no, copy the filter and its frame
+		ext_label = channel->table_ext_label;
 
-				// update the head position
-				channel->head = next_head;
-			}
-		}
+		response->ext_label_chunk_data[i] = ext_label;
+		response->status_chunk_data   [i] = read_rx_frame_buffer(channel_index, buffer_index, &response->frame_chunk_data[i], &response->age_chunk_data[i]);
+
+		// the frame buffer is read out now as far as the delta read-out is concerned
+		if(mode == ARINC429_TABLE_DELTA)  channel->dirty_map[buffer_index >> 5] &= ~(1 << (buffer_index & 0x1F));
+
+		// continue the search after the filter found (the mask maps SDI_DATA filters back to their SDI 0 position)
+		channel->table_ext_label = (ext_label & ARINC429_RX_FRAME_EXT_LABEL_MASK) + 1;
+
+		// update the stream position
+		channel->table_offset++;
 	}
 
-	// done, no response
-	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
 }
 
 
-/* define or update a frame sent via the scheduler */
-BootloaderHandleMessageResponse write_frame_scheduled(const WriteFrameScheduled *data)
+/* read the frames of all RX filters of a channel, ordered by extended label and streamed in chunks */
+BootloaderHandleMessageResponse read_frame_table_low_level(const ReadFrameTableLowLevel          *data,
+                                                                 ReadFrameTableLowLevel_Response *response)
 {
-	// check the parameters, abort if invalid
-	if(!check_channel(data->channel, GROUP_TX)     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->frame_index >= ARINC429_TX_BUFFER_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-
-	// do all TX channels
-	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
-	{
-		// channel selected?
-		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
-		{
-			// yes, store frame in the TX frame table
-			arinc429.tx_channel[i].frame_buffer[data->frame_index] = data->frame;
+	return read_frame_table_helper(data->channel, ARINC429_TABLE_FULL, response);
+}
 
-			// eligible the frame for transmit
-			update_tx_buffer_map(i, data->frame_index, ARINC429_SET);
-		}
-	}
 
-	// done, no response
-	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+/* read the frames of the RX filters of a channel that changed since their last read-out, streamed in chunks */
+BootloaderHandleMessageResponse read_frame_delta_low_level(const ReadFrameDeltaLowLevel          *data,
+                                                                 ReadFrameDeltaLowLevel_Response *response)
+{
+	return read_frame_table_helper(data->channel, ARINC429_TABLE_DELTA, response);
 }
 
-/* set a frame to be transmitted or muted */
-BootloaderHandleMessageResponse set_frame_mode(const SetFrameMode *data)
+
+/* read captured frames (monitor mode) from the capture rings, merged in the order of arrival and streamed in chunks */
+BootloaderHandleMessageResponse read_capture_low_level(const ReadCaptureLowLevel          *data,
+                                                             ReadCaptureLowLevel_Response *response)
 {
-	// check the parameters, abort if invalid
-	if(!check_channel(data->channel, GROUP_TX)     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->frame_index >= ARINC429_TX_BUFFER_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->mode        >  ARINC429_TX_MODE_MUTE )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	uint16_t  chunk_size;   // number of frames in this chunk
+	uint8_t   pick;         // RX channel with the oldest captured frame
+	uint32_t  oldest;       // time of arrival of the oldest captured frame
 
-	// do all TX channels
-	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	// prepare the response
+	response->header.length = sizeof(ReadCaptureLowLevel_Response);
+
+	// is the previous stream complete?
+	if(arinc429.capture.stream_offset >= arinc429.capture.stream_length)
 	{
-		// channel selected?
-		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		// yes, start a new stream with the frames captured by now (the subtraction is modulo the ring size)
+		arinc429.capture.stream_length = 0;
+		arinc429.capture.stream_offset = 0;
+
+		for(uint8_t k = 0; k < ARINC429_RX_CHANNELS_NUM; k++)
 		{
-			// yes, eligible (0) / disable (1) the frame for transmit
-			update_tx_buffer_map(i, data->frame_index, data->mode);
+			ARINC429RXChannel *channel = &(arinc429.rx_channel[k]);
+
+			arinc429.capture.stream_length += (channel->capture_head + ARINC429_CAPTURE_SIZE - channel->capture_tail) % ARINC429_CAPTURE_SIZE;
 		}
+
+		// limit the stream to the requested number of frames
+		if(arinc429.capture.stream_length > data->length)  arinc429.capture.stream_length = data->length;
 	}
 
-	// done, no response
-	return HANDLE_MESSAGE_RESPONSE_EMPTY;
-}
+	// compute the size of this chunk
+	chunk_size = arinc429.capture.stream_length - arinc429.capture.stream_offset;
+	if(chunk_size > ARINC429_CAPTURE_CHUNK_SIZE)  chunk_size = ARINC429_CAPTURE_CHUNK_SIZE;
 
-/* clear a range of scheduler entries */
-BootloaderHandleMessageResponse clear_schedule_entries(const ClearScheduleEntries *data)
-{
+	// collect the stream data
+	response->frames_length       = arinc429.capture.stream_length;
+	response->frames_chunk_offset = arinc429.capture.stream_offset;
+
+	// copy the frames into the chunk, unused entries are sent as zeros
+	for(uint8_t i = 0; i < ARINC429_CAPTURE_CHUNK_SIZE; i++)
+	{
+		// pick the channel whose oldest captured frame arrived first
+		pick   = ARINC429_RX_CHANNELS_NUM;
+		oldest = 0;
+
+		for(uint8_t k = 0; (i < chunk_size) && (k < ARINC429_RX_CHANNELS_NUM); k++)
+		{
+			ARINC429RXChannel *channel = &(arinc429.rx_channel[k]);
+
+			// skip the channel if its capture ring is empty
+			if(channel->capture_head == channel->capture_tail)  continue;
+
+			// get the time of arrival of its oldest captured frame
+			uint32_t timestamp = channel->capture.timestamp[(channel->capture_tail + 1) % ARINC429_CAPTURE_SIZE];
+
+			// take it if it is older than the one picked so far (the subtraction is modulo 2^32)
+			if((pick == ARINC429_RX_CHANNELS_NUM) || ((int32_t)(timestamp - oldest) < 0))
+			{
+				pick   = k;
+				oldest = timestamp;
+			}
+		}
+
+		// chunk complete, or no captured frame left? (a ring is reset when its channel is set to monitor mode again)
+		if(pick == ARINC429_RX_CHANNELS_NUM)
+		{
+			// yes, clear the entry
+			response->frame_chunk_data    [i] = 0;
+			response->timestamp_chunk_data[i] = 0;
+			response->channel_chunk_data  [i] = 0;
+
+			continue;
+		}
+
+		// no, compute the next tail position
+		ARINC429RXChannel *channel = &(arinc429.rx_channel[pick]);
+
+		if(++channel->capture_tail >= ARINC429_CAPTURE_SIZE) channel->capture_tail = 0;
+
+		// copy the frame, its time of arrival and its channel
+		response->frame_chunk_data    [i] = channel->capture.frame    [channel->capture_tail];
+		response->timestamp_chunk_data[i] = channel->capture.timestamp[channel->capture_tail];
+		response->channel_chunk_data  [i] = ARINC429_CHANNEL_RX1 + pick;
+	}
+
+	// update the stream position
+	arinc429.capture.stream_offset += chunk_size;
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* get the selector of a per-filter timeout period, assigning the period to a free selector if needed */
+/* helper function for set_rx_filter_timeout(), returns 0 if all selectors are in use                  */
+static uint8_t get_rx_timeout_select(uint8_t channel_index, uint8_t buffer_index, uint16_t timeout)
+{
+	uint16_t  users[ARINC429_RX_TIMEOUTS_NUM] = {0};  // number of frame buffers using each selector
+
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// is the timeout period assigned to a selector already?
+	for(uint8_t k = 0; k < ARINC429_RX_TIMEOUTS_NUM; k++)
+	{
+		// yes, share it
+		if(channel->timeout_periods[k] == timeout)  return k + 1;
+	}
+
+	// no, count the users of each selector, leaving out the frame buffer to be re-configured
+	for(uint16_t j = 0; j < ARINC429_RX_BUFFER_NUM; j++)
+	{
+		// skip the frame buffer to be re-configured and the unused ones
+		if((j == buffer_index) || (channel->frame_buffer[j].frame_age == ARINC429_RX_BUFFER_UNUSED))  continue;
+
+		// get the selector of the frame buffer
+		uint8_t select = (channel->timeout_select[j >> 4] >> ((j & 0x0F) << 1)) & 0x03;
+
+		// count it if the frame buffer has its own timeout period
+		if(select)  users[select - 1]++;
+	}
+
+	// assign the timeout period to the first selector not in use
+	for(uint8_t k = 0; k < ARINC429_RX_TIMEOUTS_NUM; k++)
+	{
+		if(users[k] == 0)
+		{
+			channel->timeout_periods[k] = timeout;
+
+			return k + 1;
+		}
+	}
+
+	// all selectors are in use with other timeout periods
+	return 0;
+}
+
+
+/* set the timeout period of a RX filter */
+BootloaderHandleMessageResponse set_rx_filter_timeout(const SetRXFilterTimeout          *data,
+                                                            SetRXFilterTimeout_Response *response)
+{
+	uint8_t   buffer_index;  // frame buffer of the filter
+	uint8_t   select;        // timeout period selector of the frame buffer
+
+
+	// prepare the response
+	response->header.length = sizeof(SetRXFilterTimeout_Response);
+
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX)                         )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->sdi     > ARINC429_SDI_DATA                              )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if((data->timeout > 0) && (data->timeout < 10)                     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->timeout > 60000                                          )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// compute the filter index from the SDI and label, thereby replacing SDI_DATA by SDI 0
+	uint16_t ext_label = ((data->sdi & 0x03) << 8) | data->label;
+
+	// default is successful update
+	response->success = true;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// get a pointer to the channel
+			ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+			// yes, does the SDI/label combination have a filter assigned, and do the frame buffers not hold the capture ring?
+			if(!check_sw_filter_map(i, ext_label) || check_rx_capture_active(i))
+			{
+				// no, update failed at least once
+				response->success = false;
+
+				continue;
+			}
+
+			// yes, get the frame buffer of the filter
+			buffer_index = channel->frame_filter[ext_label];
+
+			// get the selector of the timeout period, 0 selects the channel timeout period
+			select = (data->timeout) ? get_rx_timeout_select(i, buffer_index, data->timeout) : 0;
+
+			// own timeout period requested, but all selectors in use with other periods?
+			if(data->timeout && (select == 0))
+			{
+				// yes, update failed at least once
+				response->success = false;
+
+				continue;
+			}
+
+			// store the selector with the frame buffer, the period is taken exactly as given
+			// (a shorter period takes effect at the latest when the old one expires)
+			channel->timeout_select[buffer_index >> 4] &= ~(0x03   << ((buffer_index & 0x0F) << 1));
+			channel->timeout_select[buffer_index >> 4] |=  (select << ((buffer_index & 0x0F) << 1));
+		}
+	}
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+#if ARINC429_RX_STATS_NUM > 0
+/* enable or disable the receive statistics of a RX filter */
+BootloaderHandleMessageResponse set_rx_filter_statistics(const SetRXFilterStatistics          *data,
+                                                               SetRXFilterStatistics_Response *response)
+{
+	// prepare the response
+	response->header.length = sizeof(SetRXFilterStatistics_Response);
+
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->sdi > ARINC429_SDI_DATA         )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// compute the filter index from the SDI and label, thereby replacing SDI_DATA by SDI 0
+	uint16_t ext_label = ((data->sdi & 0x03) << 8) | data->label;
+
+	// default is successful update
+	response->success = true;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// get a pointer to the channel
+			ARINC429RXChannel *channel = &(arinc429.rx_channel[i]);
+
+			// yes, does the SDI/label combination have a filter assigned?
+			if(!check_sw_filter_map(i, ext_label))
+			{
+				// no, update failed at least once
+				response->success = false;
+
+				continue;
+			}
+
+			// yes, get the frame buffer of the filter
+			uint8_t buffer_index = channel->frame_filter[ext_label];
+
+			// remove the statistics the frame buffer may have already
+			release_rx_statistics(i, buffer_index);
+
+			// done if the statistics shall be disabled
+			if(!data->enabled)  continue;
+
+			// statistics left over?
+			if(channel->stats_used >= ARINC429_RX_STATS_NUM)
+			{
+				// no, update failed at least once
+				response->success = false;
+
+				continue;
+			}
+
+			// yes, get a pointer to the next free statistics
+			ARINC429RXStats *stats = &(channel->stats[channel->stats_used]);
+
+			// initialize the statistics
+			stats->frames       = 0;
+			stats->intervals    = 0;
+			stats->interval_sum = 0;
+			stats->interval_min = 0xFFFF;
+			stats->interval_max = 0;
+			stats->timeouts     = 0;
+			stats->ext_label    = (data->sdi << 8) | data->label;
+			stats->buffer_index = buffer_index;
+
+#if ARINC429_RX_STATS_HISTOGRAM
+			for(uint8_t j = 0; j < ARINC429_RX_HISTOGRAM_NUM; j++)
+			{
+				stats->histogram[j] = 0;
+			}
+#endif
+
+			// put the statistics into use
+			channel->stats_used++;
+		}
+	}
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* read the receive statistics of the RX filters of a channel, streamed in chunks */
+BootloaderHandleMessageResponse read_rx_statistics_low_level(const ReadRXStatisticsLowLevel          *data,
+                                                                   ReadRXStatisticsLowLevel_Response *response)
+{
+	ARINC429RXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(ReadRXStatisticsLowLevel_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+	}
+
+	// is the previous stream complete?
+	if(channel->stats_offset >= channel->stats_length)
+	{
+		// yes, start a new stream with all statistics in use
+		channel->stats_length = channel->stats_used;
+		channel->stats_offset = 0;
+	}
+
+	// collect the stream data
+	response->entries_length       = channel->stats_length;
+	response->entries_chunk_offset = channel->stats_offset;
+
+	// fill the chunk
+	for(uint8_t i = 0; i < ARINC429_STATS_CHUNK_SIZE; i++)
+	{
+		// stream complete or statistics removed meanwhile?
+		if((channel->stats_offset >= channel->stats_length) || (channel->stats_offset >= channel->stats_used))
+		{
+			// yes, clear the entry
+			response->ext_label_chunk_data    [i] = 0;
+			response->frames_chunk_data       [i] = 0;
+			response->interval_min_chunk_data [i] = 0;
+			response->interval_max_chunk_data [i] = 0;
+			response->interval_mean_chunk_data[i] = 0;
+			response->timeouts_chunk_data     [i] = 0;
+
+			// account for the entry if it is part of the stream
+			if(channel->stats_offset < channel->stats_length)  channel->stats_offset++;
+
+			continue;
+		}
+
+		// no, get a pointer to the statistics
+		ARINC429RXStats *stats = &(channel->stats[channel->stats_offset]);
+
+		// copy the statistics, the intervals are 0 as long as none was measured
+		response->ext_label_chunk_data    [i] = stats->ext_label;
+		response->frames_chunk_data       [i] = stats->frames;
+		response->interval_min_chunk_data [i] = (stats->intervals) ? stats->interval_min                    : 0;
+		response->interval_max_chunk_data [i] = (stats->intervals) ? stats->interval_max                    : 0;
+		response->interval_mean_chunk_data[i] = (stats->intervals) ? stats->interval_sum / stats->intervals : 0;
+		response->timeouts_chunk_data     [i] = stats->timeouts;
+
+		// update the stream position
+		channel->stats_offset++;
+	}
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+#if ARINC429_RX_STATS_HISTOGRAM
+/* get the frame age histogram of a RX filter with receive statistics */
+BootloaderHandleMessageResponse get_rx_filter_histogram(const GetRXFilterHistogram          *data,
+                                                              GetRXFilterHistogram_Response *response)
+{
+	uint8_t channel_index;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXFilterHistogram_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel_index = 0;  break;
+		case ARINC429_CHANNEL_RX2 : channel_index = 1;  break;
+	}
+
+	// check the SDI, abort if invalid
+	if(data->sdi > ARINC429_SDI_DATA)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// get a pointer to the channel
+	ARINC429RXChannel *channel = &(arinc429.rx_channel[channel_index]);
+
+	// compute the filter index from the SDI and label, thereby replacing SDI_DATA by SDI 0
+	uint16_t ext_label = ((data->sdi & 0x03) << 8) | data->label;
+
+	// default is no histogram
+	response->success = false;
+
+	// done if the SDI/label combination has no filter assigned
+	if(!check_sw_filter_map(channel_index, ext_label))  return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+
+	// search the statistics of the filter's frame buffer
+	for(uint8_t k = 0; k < channel->stats_used; k++)
+	{
+		// skip the statistics if they belong to another frame buffer
+		if(channel->stats[k].buffer_index != channel->frame_filter[ext_label])  continue;
+
+		// copy the histogram
+		for(uint8_t j = 0; j < ARINC429_HISTOGRAM_SIZE; j++)
+		{
+			response->bucket[j] = channel->stats[k].histogram[j];
+		}
+
+		// histogram found
+		response->success = true;
+
+		break;
+	}
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+#endif
+#endif
+
+
+/* get the performance counters */
+BootloaderHandleMessageResponse get_performance_counters(const GetPerformanceCounters          *data,
+                                                               GetPerformanceCounters_Response *response)
+{
+	ARINC429Perf *perf = &arinc429.perf;
+
+	// prepare the response
+	response->header.length = sizeof(GetPerformanceCounters_Response);
+
+	// collect the response data
+	response->loop_rate = perf->loop_rate;
+
+	for(uint8_t i = 0; i < ARINC429_STAGES_NUM; i++)
+	{
+		uint32_t max = perf->stage_max[i] / HI3593_CYCLES_PER_US;
+
+		response->stage_avg[i] = perf->stage_avg[i];
+		response->stage_max[i] = (max < 0xFFFF) ? max : 0xFFFF;
+	}
+
+	response->callback_high_water = perf->callback_high_water;
+	response->tx_queue_high_water = perf->tx_queue_high_water;
+	response->budget_exhausted[0] = perf->budget_exhausted[0];
+	response->budget_exhausted[1] = perf->budget_exhausted[1];
+	response->spi_transactions    = hi3593.spi_transactions;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* enable or disable the RX FIFO overflow callback */
+BootloaderHandleMessageResponse set_rx_overflow_configuration(const SetRXOverflowConfiguration *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, store the new setting
+			arinc429.rx_channel[i].overflow_callback = data->enabled;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get the RX FIFO overflow callback setting */
+BootloaderHandleMessageResponse get_rx_overflow_configuration(const GetRXOverflowConfiguration          *data,
+                                                                    GetRXOverflowConfiguration_Response *response)
+{
+	uint8_t channel_index;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXOverflowConfiguration_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel_index = 0;  break;
+		case ARINC429_CHANNEL_RX2 : channel_index = 1;  break;
+	}
+
+	// collect the response data
+	response->enabled = arinc429.rx_channel[channel_index].overflow_callback;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* get the RX FIFO overflow counter */
+BootloaderHandleMessageResponse get_rx_fifo_overflows(const GetRXFIFOOverflows          *data,
+                                                            GetRXFIFOOverflows_Response *response)
+{
+	uint8_t channel_index;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXFIFOOverflows_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel_index = 0;  break;
+		case ARINC429_CHANNEL_RX2 : channel_index = 1;  break;
+	}
+
+	// collect the response data
+	response->overflows = arinc429.rx_channel[channel_index].fifo_overflows;
+	response->fifo_full = arinc429.rx_channel[channel_index].fifo_full;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* get the timeout period of a RX filter */
+BootloaderHandleMessageResponse get_rx_filter_timeout(const GetRXFilterTimeout          *data,
+                                                            GetRXFilterTimeout_Response *response)
+{
+	uint8_t  channel_index;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXFilterTimeout_Response);
+
+	// check the SDI parameter, abort if invalid
+	if(data->sdi > ARINC429_SDI_DATA)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel_index = 0; break;
+		case ARINC429_CHANNEL_RX2 : channel_index = 1; break;
+	}
+
+	// compute the filter index from the SDI and label, thereby replacing SDI_DATA by SDI 0
+	uint16_t ext_label = ((data->sdi & 0x03) << 8) | data->label;
+
+	// does the SDI/label combination have a filter assigned?
+	if(check_sw_filter_map(channel_index, ext_label))
+	{
+		// yes, collect the response data
+		response->configured = true;
+		response->timeout    = get_rx_timeout_period(channel_index, arinc429.rx_channel[channel_index].frame_filter[ext_label]);
+	}
+	else
+	{
+		// no, set a default response
+		response->configured = false;
+		response->timeout    = 0;
+	}
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* set configuration of the RX frame callback */
+BootloaderHandleMessageResponse set_rx_callback_configuration(const SetRXCallbackConfiguration *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->timeout < 10                    )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->timeout > 60000                 )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// determine the mode - step 1: on_change or not
+	uint8_t mode = (data->value_has_to_change == true) ? ARINC429_CALLBACK_ON_CHANGE : ARINC429_CALLBACK_ON;
+
+	// determine the mode - step 2: on(_change) or off
+	if(data->enabled == false)  mode = ARINC429_CALLBACK_OFF;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, update the channel data
+			arinc429.rx_channel[i].common.callback_mode = mode;
+			arinc429.rx_channel[i].timeout_period       = data->timeout;
+
+			// request execution of the update
+			arinc429.rx_channel[i].common.change_request |= ARINC429_UPDATE_CALLBACK_MODE;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get configuration of the RX frame callback */
+BootloaderHandleMessageResponse get_rx_callback_configuration(const GetRXCallbackConfiguration          *data,
+                                                                    GetRXCallbackConfiguration_Response *response)
+{
+	ARINC429RXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXCallbackConfiguration_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+	}
+
+	// determine the response for 'enabled' and 'value_has_to_change'
+	switch(channel->common.callback_mode & 0x07)
+	{
+		default                          : /* FALLTHROUGH */
+		case ARINC429_CALLBACK_OFF       : response->enabled = false; response->value_has_to_change = false;  break;
+		case ARINC429_CALLBACK_ON        : response->enabled = true;  response->value_has_to_change = false;  break;
+		case ARINC429_CALLBACK_ON_CHANGE : response->enabled = true;  response->value_has_to_change = true;   break;
+	}
+
+	// get the response for 'timeout'
+	response->timeout  = channel->timeout_period;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* set configuration of the RX frame batch callback */
+BootloaderHandleMessageResponse set_rx_batch_configuration(const SetRXBatchConfiguration *data)
+{
+	// check the channel parameter, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, update the channel data (takes effect with the next frame message sent)
+			arinc429.rx_channel[i].common.batch_mode = (data->enabled) ? ARINC429_CALLBACK_BATCH_ON : ARINC429_CALLBACK_BATCH_OFF;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get configuration of the RX frame batch callback */
+BootloaderHandleMessageResponse get_rx_batch_configuration(const GetRXBatchConfiguration          *data,
+                                                                 GetRXBatchConfiguration_Response *response)
+{
+	ARINC429RXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXBatchConfiguration_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+	}
+
+	// collect the response data
+	response->enabled = (channel->common.batch_mode == ARINC429_CALLBACK_BATCH_ON);
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* set coalescing window of the RX frame batch callback */
+BootloaderHandleMessageResponse set_rx_batch_coalescing(const SetRXBatchCoalescing *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX)             )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->min_frames  < 1                              )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->min_frames  > ARINC429_CALLBACK_BATCH_SIZE   )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->max_latency > ARINC429_CALLBACK_BATCH_LATENCY)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, update the channel data
+			arinc429.rx_channel[i].common.batch_min     = data->min_frames;
+			arinc429.rx_channel[i].common.batch_latency = data->max_latency;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get coalescing window of the RX frame batch callback */
+BootloaderHandleMessageResponse get_rx_batch_coalescing(const GetRXBatchCoalescing          *data,
+                                                              GetRXBatchCoalescing_Response *response)
+{
+	ARINC429RXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXBatchCoalescing_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+	}
+
+	// collect the response data
+	response->min_frames  = channel->common.batch_min;
+	response->max_latency = channel->common.batch_latency;
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* put frames into the immediate transmit queue of a TX channel, returns the number of frames taken */
+static uint8_t enqueue_tx_frames(uint8_t channel_index, const uint32_t *frame, uint8_t frames_num)
+{
+	uint8_t  next_head;  // head position in immediate transmit queue
+	uint8_t  accepted;   // number of frames taken
+
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[channel_index]);
+
+	// take the frames in order as long as the queue has room
+	for(accepted = 0; accepted < frames_num; accepted++)
+	{
+		// get the current head position
+		next_head = channel->head;
+
+		// compute the next head position
+		if(++next_head >= ARINC429_TX_QUEUE_SIZE) next_head = 0;
+
+		// done if the immediate transmit queue is full
+		if(next_head == channel->tail)  break;
+
+		// enqueue the frame
+		channel->queue[next_head] = frame[accepted];
+
+		// update the head position
+		channel->head = next_head;
+	}
+
+	// track the max fill level of the queue
+	uint8_t fill = get_tx_queue_fill(channel_index);
+
+	if(fill > arinc429.perf.tx_queue_high_water)  arinc429.perf.tx_queue_high_water = fill;
+
+	// arm the credits callback once the fill level is above the watermark
+	if(channel->credit_callback && (fill > channel->credit_watermark))  channel->credit_state = ARINC429_CREDITS_ARMED;
+
+	// done
+	return accepted;
+}
+
+
+/* send a frame immediately */
+BootloaderHandleMessageResponse write_frame_direct(const WriteFrameDirect *data)
+{
+	// check the channel parameter, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, enqueue the frame, increment the statistics counter on lost frames if the queue is full
+			if(!enqueue_tx_frames(i, &data->frame, 1))  arinc429.tx_channel[i].common.frames_lost_curr++;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* send a number of frames immediately */
+BootloaderHandleMessageResponse write_frames_direct(const WriteFramesDirect          *data,
+                                                          WriteFramesDirect_Response *response)
+{
+	uint8_t accepted;
+
+	// prepare the response
+	response->header.length = sizeof(WriteFramesDirect_Response);
+
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)         )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->frames_length > ARINC429_WRITE_CHUNK_SIZE)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// all frames accepted unless a channel queue runs full
+	response->frames_accepted = data->frames_length;
+	response->credits         = ARINC429_TX_QUEUE_SIZE - 1;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, enqueue the frames - the ones not taken are reported back instead of being counted as lost
+			accepted = enqueue_tx_frames(i, data->frame, data->frames_length);
+
+			// report the lowest number taken by any of the selected channels
+			if(accepted < response->frames_accepted)  response->frames_accepted = accepted;
+
+			// report the lowest number of free queue entries of the selected channels
+			uint8_t credits = ARINC429_TX_QUEUE_SIZE - 1 - get_tx_queue_fill(i);
+
+			if(credits < response->credits)  response->credits = credits;
+		}
+	}
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* set the TX queue credits callback */
+BootloaderHandleMessageResponse set_tx_credit_configuration(const SetTXCreditConfiguration *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)      )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->watermark > ARINC429_TX_QUEUE_SIZE - 2)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, get a pointer to the channel
+			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
+
+			// store the new settings
+			channel->credit_callback  = data->enabled;
+			channel->credit_watermark = data->watermark;
+
+			// wait for the queue to fill above the new watermark before the first callback
+			channel->credit_state     = ARINC429_CREDITS_IDLE;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get the TX queue credits callback setting */
+BootloaderHandleMessageResponse get_tx_credit_configuration(const GetTXCreditConfiguration          *data,
+                                                                  GetTXCreditConfiguration_Response *response)
+{
+	ARINC429TXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetTXCreditConfiguration_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_TX1 : channel = &(arinc429.tx_channel[0]);  break;
+	}
+
+	// collect the response data
+	response->enabled   = channel->credit_callback;
+	response->watermark = channel->credit_watermark;
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* define or update a frame sent via the scheduler */
+BootloaderHandleMessageResponse write_frame_scheduled(const WriteFrameScheduled *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->frame_index >= ARINC429_TX_BUFFER_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, store frame in the TX frame table
+			arinc429.tx_channel[i].frame_buffer[data->frame_index] = data->frame;
+
+			// eligible the frame for transmit
+			update_tx_buffer_map(i, data->frame_index, ARINC429_SET);
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+/* set a frame to be transmitted or muted */
+BootloaderHandleMessageResponse set_frame_mode(const SetFrameMode *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->frame_index >= ARINC429_TX_BUFFER_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->mode        >  ARINC429_TX_MODE_MUTE )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, eligible (0) / disable (1) the frame for transmit
+			update_tx_buffer_map(i, data->frame_index, data->mode);
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+/* clear a range of scheduler entries */
+BootloaderHandleMessageResponse clear_schedule_entries(const ClearScheduleEntries *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)       )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->job_index_first >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->job_index_first >  data->job_index_last)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->job_index_last  >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, get a pointer to the channel
+			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
+
+			// clear the task entries (this can be done while the scheduler is running)
+			for(uint16_t j = data->job_index_first; j <= data->job_index_last; j++)
+			{
+				// is the task already unused?
+				if((channel->job_frame[j] & ARINC429_TX_JOB_JOBCODE_MASK) != (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS))
+				{
+					// no, set the task to 'skip' aka unused
+					channel->job_frame[j] = ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS;
+
+					// decrement the number of used task entries
+					channel->scheduler_jobs_used--;
+
+					// update the job map
+					update_tx_job_map(i, j, ARINC429_CLEAR);
+				}
+			}
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* check the parameters of a scheduler entry */
+static bool check_schedule_entry(uint16_t job_index, uint8_t job, uint16_t frame_index, uint8_t dwell_time)
+{
+	// check the parameters, abort if invalid
+	if( job_index    >= ARINC429_TX_JOBS_NUM              )  return false;
+	if( job          >  ARINC429_SCHEDULER_JOB_RETRANS_RX2)  return false;
+	if( dwell_time   >  250                               )  return false;
+
+	// check the frame index parameter
+	switch(job)
+	{
+		// transmit from TX frame buffer - abort on invalid TX frame table index
+		case ARINC429_SCHEDULER_JOB_SINGLE      : /* FALLTHROUGH */
+		case ARINC429_SCHEDULER_JOB_CYCLIC      :
+
+			return (frame_index < ARINC429_TX_BUFFER_NUM);
+
+
+		// transmit from RX frame buffer - abort on invalid extended label (SDI + label)
+		case ARINC429_SCHEDULER_JOB_RETRANS_RX1 : /* FALLTHROUGH */
+		case ARINC429_SCHEDULER_JOB_RETRANS_RX2 :
+
+			return (frame_index < 0x0400                );
+
+
+		// callback label - abort on invalid label number
+		case ARINC429_SCHEDULER_JOB_CALLBACK    :
+
+			return (frame_index < 0x0100                );
+
+		// jump command
+		case ARINC429_SCHEDULER_JOB_JUMP        :
+
+			return (frame_index < ARINC429_TX_JOBS_NUM  );
+
+		// any other job not using the frame index parameter
+		default:                                  return true;
+	}
+}
+
+
+/* set a scheduler entry */
+BootloaderHandleMessageResponse set_schedule_entry(const SetScheduleEntry *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)                                               )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if(!check_schedule_entry(data->job_index, data->job, data->frame_index, data->dwell_time))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, get a pointer to the channel
+			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
+
+			// is the task in use already?
+			if((channel->job_frame[data->job_index] & ARINC429_TX_JOB_JOBCODE_MASK) == (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS))
+			{
+				// no, increment the number of used task entries
+				channel->scheduler_jobs_used++;
+			}
+
+			// update the task table
+			channel->dwell_time[data->job_index] = data->dwell_time;
+			channel->job_frame [data->job_index] = (data->job << ARINC429_TX_JOB_JOBCODE_POS) | (data->frame_index << ARINC429_TX_JOB_INDEX_POS);
+
+			// update the job map
+			update_tx_job_map(i, data->job_index, (data->job == ARINC429_SCHEDULER_JOB_SKIP) ? ARINC429_CLEAR : ARINC429_SET);
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get a scheduler entry */
+BootloaderHandleMessageResponse get_schedule_entry(const GetScheduleEntry          *data,
+                                                         GetScheduleEntry_Response *response)
+{
+	ARINC429TXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetScheduleEntry_Response);
+
+	// check the parameter, abort if invalid
+	if(data->job_index >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_TX1 : channel = &(arinc429.tx_channel[0]);  break;
+	}
+
+	// collect the response data
+	response->job         = (channel->job_frame[data->job_index] & ARINC429_TX_JOB_JOBCODE_MASK) >> ARINC429_TX_JOB_JOBCODE_POS;
+	response->frame_index = (channel->job_frame[data->job_index] & ARINC429_TX_JOB_INDEX_MASK  ) >> ARINC429_TX_JOB_INDEX_POS;
+
+	response->dwell_time  = (response->job == ARINC429_SCHEDULER_JOB_SKIP) ? 0 : channel->dwell_time  [data->job_index     ];
+	response->frame       = (response->job == ARINC429_SCHEDULER_JOB_SKIP) ? 0 : channel->frame_buffer[response->frame_index];
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* set the time base of the scheduler dwell times */
+BootloaderHandleMessageResponse set_schedule_time_base(const SetScheduleTimeBase *data)
+{
 	// check the parameters, abort if invalid
-	if(!check_channel(data->channel, GROUP_TX)       )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->job_index_first >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->job_index_first >  data->job_index_last)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->job_index_last  >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if(!check_channel(data->channel, GROUP_TX)        )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->dwell_unit > ARINC429_TIME_BASE_UNIT_MAX)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
 	// do all TX channels
 	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
@@ -1172,19 +2487,11 @@ BootloaderHandleMessageResponse clear_schedule_entries(const ClearScheduleEntrie
 			// yes, get a pointer to the channel
 			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
 
-			// clear the task entries (this can be done while the scheduler is running)
-			for(uint16_t j = data->job_index_first; j <= data->job_index_last; j++)
-			{
-				// is the task already unused?
-				if((channel->job_frame[j] & ARINC429_TX_JOB_JOBCODE_MASK) != (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS))
-				{
-					// no, set the task to 'skip' aka unused
-					channel->job_frame[j] = ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS;
+			// store the new time base
+			channel->dwell_unit = data->dwell_unit;
 
-					// decrement the number of used task entries
-					channel->scheduler_jobs_used--;
-				}
-			}
+			// request execution of the update
+			channel->common.change_request |= ARINC429_UPDATE_TIME_BASE;
 		}
 	}
 
@@ -1193,46 +2500,100 @@ BootloaderHandleMessageResponse clear_schedule_entries(const ClearScheduleEntrie
 }
 
 
-/* set a scheduler entry */
-BootloaderHandleMessageResponse set_schedule_entry(const SetScheduleEntry *data)
+/* get the time base of the scheduler dwell times */
+BootloaderHandleMessageResponse get_schedule_time_base(const GetScheduleTimeBase          *data,
+                                                             GetScheduleTimeBase_Response *response)
 {
-	// check the parameters, abort if invalid
-	if(!check_channel(data->channel, GROUP_TX)                  )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->job_index    >= ARINC429_TX_JOBS_NUM              )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->job          >  ARINC429_SCHEDULER_JOB_RETRANS_RX2)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
-	if( data->dwell_time   >  250                               )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	ARINC429TXChannel *channel;
 
-	// check the frame index parameter
-	switch(data->job)
+	// prepare the response
+	response->header.length = sizeof(GetScheduleTimeBase_Response);
+
+	// pick the selected channel
+	switch(data->channel)
 	{
-		// transmit from TX frame buffer - abort on invalid TX frame table index
-		case ARINC429_SCHEDULER_JOB_SINGLE      : /* FALLTHROUGH */
-		case ARINC429_SCHEDULER_JOB_CYCLIC      :
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
-			if(data->frame_index < ARINC429_TX_BUFFER_NUM) break; else return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+		case ARINC429_CHANNEL_TX1 : channel = &(arinc429.tx_channel[0]);  break;
+	}
 
+	// collect the response data
+	response->dwell_unit = channel->dwell_unit;
+
+	// done, send the response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
 
-		// transmit from RX frame buffer - abort on invalid extended label (SDI + label)
-		case ARINC429_SCHEDULER_JOB_RETRANS_RX1 : /* FALLTHROUGH */
-		case ARINC429_SCHEDULER_JOB_RETRANS_RX2 :
 
-			if(data->frame_index < 0x0400                ) break; else return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+/* stage a scheduler entry, it is applied with the other staged entries at the end of the schedule cycle */
+BootloaderHandleMessageResponse stage_schedule_entry(const StageScheduleEntry          *data,
+                                                           StageScheduleEntry_Response *response)
+{
+	uint8_t k;
 
+	// prepare the response
+	response->header.length = sizeof(StageScheduleEntry_Response);
 
-		// callback label - abort on invalid label number
-		case ARINC429_SCHEDULER_JOB_CALLBACK    :
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)                                               )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if(!check_schedule_entry(data->job_index, data->job, data->frame_index, data->dwell_time))  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
 
-			if(data->frame_index < 0x0100                ) break; else return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	// staged unless a selected channel can not take it
+	response->status = ARINC429_STAGING_ACCEPTED;
 
-		// jump command
-		case ARINC429_SCHEDULER_JOB_JUMP        :
+	// do all TX channels
+	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_TX) || (data->channel == ARINC429_CHANNEL_TX1 + i))
+		{
+			// yes, get a pointer to the channel
+			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
+
+			// the staged entries are frozen while a commit is pending
+			if(channel->schedule_commit == ARINC429_COMMIT_PENDING)
+			{
+				response->status = ARINC429_STAGING_COMMIT_PENDING;
 
-			if(data->frame_index < ARINC429_TX_JOBS_NUM  ) break; else return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+				continue;
+			}
 
-		// any other job not using the frame index parameter
-		default:                                           break;
+			// search the job index among the staged entries, a repeated change replaces the earlier one
+			for(k = 0; k < channel->staged_used; k++)
+			{
+				if(channel->staged_index[k] == data->job_index)  break;
+			}
+
+			// new entry with the staging buffer full?
+			if(k >= ARINC429_TX_STAGED_NUM)
+			{
+				// yes, refuse it
+				response->status = ARINC429_STAGING_BUFFER_FULL;
+
+				continue;
+			}
+
+			// stage the entry
+			channel->staged_index[k] = data->job_index;
+			channel->staged_frame[k] = (data->job << ARINC429_TX_JOB_JOBCODE_POS) | (data->frame_index << ARINC429_TX_JOB_INDEX_POS);
+			channel->staged_dwell[k] = data->dwell_time;
+
+			if(k == channel->staged_used)  channel->staged_used++;
+		}
 	}
 
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
+/* commit or discard the staged scheduler entries */
+BootloaderHandleMessageResponse commit_schedule(const CommitSchedule *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_TX)   )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->action > ARINC429_SCHEDULE_DISCARD)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
 	// do all TX channels
 	for(uint8_t i = 0; i < ARINC429_TX_CHANNELS_NUM; i++)
 	{
@@ -1242,16 +2603,23 @@ BootloaderHandleMessageResponse set_schedule_entry(const SetScheduleEntry *data)
 			// yes, get a pointer to the channel
 			ARINC429TXChannel *channel = &(arinc429.tx_channel[i]);
 
-			// is the task in use already?
-			if((channel->job_frame[data->job_index] & ARINC429_TX_JOB_JOBCODE_MASK) == (ARINC429_SCHEDULER_JOB_SKIP << ARINC429_TX_JOB_JOBCODE_POS))
+			// discard?
+			if(data->action == ARINC429_SCHEDULE_DISCARD)
 			{
-				// no, increment the number of used task entries
-				channel->scheduler_jobs_used++;
+				// yes, drop the staged entries, including a pending commit
+				channel->staged_used     = 0;
+				channel->schedule_commit = ARINC429_COMMIT_NONE;
+			}
+			else if(channel->common.operating_mode == ARINC429_CHANNEL_MODE_RUN)
+			{
+				// scheduler running, apply the staged entries at the end of the current schedule cycle
+				channel->schedule_commit = ARINC429_COMMIT_PENDING;
+			}
+			else
+			{
+				// scheduler not running, apply the staged entries right now
+				apply_staged_schedule(i);
 			}
-
-			// update the task table
-			channel->dwell_time[data->job_index] = data->dwell_time;
-			channel->job_frame [data->job_index] = (data->job << ARINC429_TX_JOB_JOBCODE_POS) | (data->frame_index << ARINC429_TX_JOB_INDEX_POS);
 		}
 	}
 
@@ -1260,17 +2628,14 @@ BootloaderHandleMessageResponse set_schedule_entry(const SetScheduleEntry *data)
 }
 
 
-/* get a scheduler entry */
-BootloaderHandleMessageResponse get_schedule_entry(const GetScheduleEntry          *data,
-                                                         GetScheduleEntry_Response *response)
+/* get the number of staged scheduler entries and the commit state */
+BootloaderHandleMessageResponse get_schedule_commit_status(const GetScheduleCommitStatus          *data,
+                                                                 GetScheduleCommitStatus_Response *response)
 {
 	ARINC429TXChannel *channel;
 
 	// prepare the response
-	response->header.length = sizeof(GetScheduleEntry_Response);
-
-	// check the parameter, abort if invalid
-	if(data->job_index >= ARINC429_TX_JOBS_NUM)  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	response->header.length = sizeof(GetScheduleCommitStatus_Response);
 
 	// pick the selected channel
 	switch(data->channel)
@@ -1281,11 +2646,8 @@ BootloaderHandleMessageResponse get_schedule_entry(const GetScheduleEntry
 	}
 
 	// collect the response data
-	response->job         = (channel->job_frame[data->job_index] & ARINC429_TX_JOB_JOBCODE_MASK) >> ARINC429_TX_JOB_JOBCODE_POS;
-	response->frame_index = (channel->job_frame[data->job_index] & ARINC429_TX_JOB_INDEX_MASK  ) >> ARINC429_TX_JOB_INDEX_POS;
-
-	response->dwell_time  = (response->job == ARINC429_SCHEDULER_JOB_SKIP) ? 0 : channel->dwell_time  [data->job_index     ];
-	response->frame       = (response->job == ARINC429_SCHEDULER_JOB_SKIP) ? 0 : channel->frame_buffer[response->frame_index];
+	response->entries_staged = channel->staged_used;
+	response->commit_pending = (channel->schedule_commit == ARINC429_COMMIT_PENDING);
 
 	// done, send the response
 	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
@@ -1306,6 +2668,64 @@ BootloaderHandleMessageResponse restart(const Restart *data)
 }
 
 
+/* set the labels of the RX priority label mail boxes */
+BootloaderHandleMessageResponse set_rx_priority_configuration(const SetRXPriorityConfiguration *data)
+{
+	// check the parameters, abort if invalid
+	if(!check_channel(data->channel, GROUP_RX)     )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+	if( data->mode    > ARINC429_PRIORITY_ENABLED  )  return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+	// do all RX channels
+	for(uint8_t i = 0; i < ARINC429_RX_CHANNELS_NUM; i++)
+	{
+		// channel selected?
+		if((data->channel == ARINC429_CHANNEL_RX) || (data->channel == ARINC429_CHANNEL_RX1 + i))
+		{
+			// yes, store the new configuration
+			arinc429.rx_channel[i].priority_mode     = data->mode;
+			arinc429.rx_channel[i].priority_label[0] = data->label[0];
+			arinc429.rx_channel[i].priority_label[1] = data->label[1];
+			arinc429.rx_channel[i].priority_label[2] = data->label[2];
+
+			// request execution of the update
+			arinc429.rx_channel[i].common.change_request |= ARINC429_UPDATE_PRIORITY;
+		}
+	}
+
+	// done, no response
+	return HANDLE_MESSAGE_RESPONSE_EMPTY;
+}
+
+
+/* get the labels of the RX priority label mail boxes */
+BootloaderHandleMessageResponse get_rx_priority_configuration(const GetRXPriorityConfiguration          *data,
+                                                                    GetRXPriorityConfiguration_Response *response)
+{
+	ARINC429RXChannel *channel;
+
+	// prepare the response
+	response->header.length = sizeof(GetRXPriorityConfiguration_Response);
+
+	// pick the selected channel
+	switch(data->channel)
+	{
+		default                   : return HANDLE_MESSAGE_RESPONSE_INVALID_PARAMETER;
+
+		case ARINC429_CHANNEL_RX1 : channel = &(arinc429.rx_channel[0]);  break;
+		case ARINC429_CHANNEL_RX2 : channel = &(arinc429.rx_channel[1]);  break;
+	}
+
+	// collect the response data
+	response->mode     = channel->priority_mode;
+	response->label[0] = channel->priority_label[0];
+	response->label[1] = channel->priority_label[1];
+	response->label[2] = channel->priority_label[2];
+
+	// done, send response
+	return HANDLE_MESSAGE_RESPONSE_NEW_MESSAGE;
+}
+
+
 /****************************************************************************/
 /* callbacks                                                                */
 /****************************************************************************/
@@ -1319,8 +2739,14 @@ bool enqueue_message(uint8_t message, uint16_t timestamp, uint32_t frame, uint16
 	// compute the next head position
 	if(++next_head >= ARINC429_CB_QUEUE_SIZE) next_head = 0;
 
-	// abort if there is no free space in the message queue
-	if(next_head == arinc429.callback.tail)  return false;
+	// is there free space in the message queue?
+	if(next_head == arinc429.callback.tail)
+	{
+		// no, count the overflow and abort
+		arinc429.system.queue_overflows++;
+
+		return false;
+	}
 
 	// enqueue the message
 	arinc429.callback.message  [next_head] = message;
@@ -1331,31 +2757,199 @@ bool enqueue_message(uint8_t message, uint16_t timestamp, uint32_t frame, uint16
 	// update the head position
 	arinc429.callback.head = next_head;
 
+	// track the max fill level of the queue
+	uint16_t fill = (next_head >= arinc429.callback.tail) ? next_head - arinc429.callback.tail : next_head + ARINC429_CB_QUEUE_SIZE - arinc429.callback.tail;
+
+	if(fill > arinc429.perf.callback_high_water)  arinc429.perf.callback_high_water = fill;
+
 	// done, message successfully enqueued
 	return true;
 }
 
 
+/* check if a queued message is a frame message to be sent as part of a frame batch */
+static bool check_batch_message(uint8_t message)
+{
+	switch(message)
+	{
+		case ARINC429_CALLBACK_JOB_NEW_RX1     :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_NEW_RX2     :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_FRAME_RX1   :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_FRAME_RX2   :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_TIMEOUT_RX1 :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_TIMEOUT_RX2 :  return (arinc429.rx_channel[message & 1].common.batch_mode == ARINC429_CALLBACK_BATCH_ON);
+
+		default                                :  return false;
+	}
+}
+
+
+/* check if the frame messages starting at the given queue position are to be sent now as a frame batch */
+static bool check_batch_flush(uint16_t index)
+{
+	// the coalescing window is the one of the channel of the oldest frame message
+	const ARINC429Common *common = &(arinc429.rx_channel[arinc429.callback.message[index] & 1].common);
+
+	// send if the oldest frame message is held back long enough
+	if((uint16_t)((uint16_t)system_timer_get_ms() - arinc429.callback.timestamp[index]) >= common->batch_latency)  return true;
+
+	// count the queued frame messages up to the min number of frames
+	for(uint8_t n = 1; n < common->batch_min; n++)
+	{
+		// hold back if there are no more messages queued
+		if(index == arinc429.callback.head)  return false;
+
+		// compute the next position
+		if(++index >= ARINC429_CB_QUEUE_SIZE) index = 0;
+
+		// send if the batch can not grow any further because another message type follows
+		if(!check_batch_message(arinc429.callback.message[index]))  return true;
+	}
+
+	// enough frame messages queued
+	return true;
+}
+
+
+/* send the frame messages at the tail of the callback queue as one frame batch */
+static void handle_frame_batch(void)
+{
+	static Frame_Batch_Callback  cb_batch;
+	       uint16_t              next_tail;
+	       uint8_t               message;
+	       uint8_t               n;
+
+	// create the callback message
+	tfp_make_default_header(&cb_batch.header, bootloader_get_uid(), sizeof(Frame_Batch_Callback), FID_CALLBACK_FRAME_BATCH_MESSAGE);
+
+	// clear the frame entries, unused ones are sent as zeros
+	memset(cb_batch.channel_status, 0, sizeof(cb_batch.channel_status));
+	memset(cb_batch.frame,          0, sizeof(cb_batch.frame         ));
+	memset(cb_batch.age,            0, sizeof(cb_batch.age           ));
+
+	// collect the frame messages up to the first message that does not belong to a frame batch
+	for(n = 0; (n < ARINC429_CALLBACK_BATCH_SIZE) && (arinc429.callback.tail != arinc429.callback.head); n++)
+	{
+		// compute the next tail position
+		next_tail = arinc429.callback.tail;
+		if(++next_tail >= ARINC429_CB_QUEUE_SIZE) next_tail = 0;
+
+		// get the message type, done if it does not belong to a frame batch
+		message = arinc429.callback.message[next_tail];
+		if(!check_batch_message(message))  break;
+
+		// the time stamp of the batch is the one of the first frame
+		if(n == 0)  cb_batch.timestamp = arinc429.callback.timestamp[next_tail];
+
+		// collect the frame data, status and age
+		cb_batch.frame[n] = arinc429.callback.frame[next_tail];
+
+		switch(message)
+		{
+			case ARINC429_CALLBACK_JOB_NEW_RX1     : /* FALLTHROUGH */
+			case ARINC429_CALLBACK_JOB_NEW_RX2     : cb_batch.channel_status[n] = ((message & 1) << 4) | ARINC429_STATUS_NEW;     cb_batch.age[n] = 0;                                       break;
+
+			case ARINC429_CALLBACK_JOB_FRAME_RX1   : /* FALLTHROUGH */
+			case ARINC429_CALLBACK_JOB_FRAME_RX2   : cb_batch.channel_status[n] = ((message & 1) << 4) | ARINC429_STATUS_UPDATE;  cb_batch.age[n] = arinc429.callback.age_token[next_tail]; break;
+
+			case ARINC429_CALLBACK_JOB_TIMEOUT_RX1 : /* FALLTHROUGH */
+			case ARINC429_CALLBACK_JOB_TIMEOUT_RX2 : cb_batch.channel_status[n] = ((message & 1) << 4) | ARINC429_STATUS_TIMEOUT; cb_batch.age[n] = arinc429.callback.age_token[next_tail]; break;
+
+			default                                : /* never get here */                                                                                                                break;
+		}
+
+		// update the tail position
+		arinc429.callback.tail = next_tail;
+	}
+
+	// complete the callback message
+	cb_batch.frames_num = n;
+	cb_batch.seq_number = arinc429.callback.batch_seq_number;
+
+	// increment the sequence number, thereby skipping the value 0
+	if(++arinc429.callback.batch_seq_number == 0) ++arinc429.callback.batch_seq_number;
+
+	// send the callback message
+	bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_batch, sizeof(Frame_Batch_Callback));
+}
+
+
+/* send a due TX queue credits callback, the credits are taken at the time of sending */
+static bool handle_tx_credits(void)
+{
+	static TXCredits_Callback cb_credits;
+
+	// get a pointer to the channel
+	ARINC429TXChannel *channel = &(arinc429.tx_channel[0]);
+
+	// done if there is no credits callback due
+	if(channel->credit_state != ARINC429_CREDITS_DUE)  return false;
+
+	// create the callback message
+	tfp_make_default_header(&cb_credits.header, bootloader_get_uid(), sizeof(TXCredits_Callback), FID_CALLBACK_TX_CREDITS);
+
+	// get a pointer to the sequence number, the credits are numbered in line with the scheduler messages
+	uint8_t *seq_number = &channel->common.frame_seq_number;
+
+	// collect the callback message data
+	cb_credits.channel    =  ARINC429_CHANNEL_TX1;
+	cb_credits.status     =  ARINC429_STATUS_CREDITS;
+	cb_credits.seq_number = *seq_number;
+	cb_credits.timestamp  =  (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
+	cb_credits.credits    =  ARINC429_TX_QUEUE_SIZE - 1 - get_tx_queue_fill(0);
+
+	// increment the sequence number, thereby skipping the value 0
+	if(++(*seq_number) == 0) ++(*seq_number);
+
+	// send the callback message
+	bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_credits, sizeof(TXCredits_Callback));
+
+	// wait for the queue to fill above the watermark again
+	channel->credit_state = ARINC429_CREDITS_IDLE;
+
+	return true;
+}
+
+
 /* generate callbacks */
 bool handle_callbacks(void)
 {
-	static Heartbeat_Callback  cb_heartbeat;
-	static Frame_Callback      cb_frame;
-	static Scheduler_Callback  cb_scheduler;
-	       uint8_t            *seq_number;
-
-	// done if there is no pending message request in the queue
-	if(arinc429.callback.tail == arinc429.callback.head)           return false;
+	static Heartbeat_Callback          cb_heartbeat;
+	static ExtendedHeartbeat_Callback  cb_heartbeat_ext;
+	static Frame_Callback              cb_frame;
+	static Scheduler_Callback          cb_scheduler;
+	static FIFOOverflow_Callback       cb_overflow;
+	       ARINC429Common             *common;
+	       uint8_t                     channel;
+	       uint8_t                    *seq_number;
 
 	// done if the last callback is still pending transmission
 	if(!bootloader_spitfp_is_send_possible(&bootloader_status.st)) return false;
 
+	// TX queue credits are sent ahead of the queued messages
+	if(handle_tx_credits())                                        return true;
+
+	// done if there is no pending message request in the queue
+	if(arinc429.callback.tail == arinc429.callback.head)           return false;
+
 	// get the current tail position in the callback queue
 	uint16_t next_tail = arinc429.callback.tail;
 
 	// compute the next tail position
 	if(++next_tail >= ARINC429_CB_QUEUE_SIZE) next_tail = 0;
 
+	// is the next message a frame message of a channel with frame batches enabled?
+	if(check_batch_message(arinc429.callback.message[next_tail]))
+	{
+		// yes, hold it back while the coalescing window is still open
+		if(!check_batch_flush(next_tail))  return false;
+
+		// send it together with the following frame messages
+		handle_frame_batch();
+
+		return true;
+	}
+
 	// get the message data
 	uint8_t  message   = arinc429.callback.message  [next_tail];
 	uint16_t timestamp = arinc429.callback.timestamp[next_tail];
@@ -1372,38 +2966,64 @@ bool handle_callbacks(void)
 		case ARINC429_CALLBACK_JOB_STATS_RX1 :  /* FALLTHROUGH */
 		case ARINC429_CALLBACK_JOB_STATS_RX2 :
 
-			//create the callback message
-			tfp_make_default_header(&cb_heartbeat.header, bootloader_get_uid(), sizeof(Heartbeat_Callback), FID_CALLBACK_HEARTBEAT);
-
-			// collect the callback message data
-			cb_heartbeat.status              = ARINC429_STATUS_STATISTICS;
-			cb_heartbeat.timestamp           = timestamp;
-
+			// get the channel
 			if (message == ARINC429_CALLBACK_JOB_STATS_TX1)
 			{
-				seq_number = &arinc429.tx_channel[0].common.stats_seq_number;
+				common  = &arinc429.tx_channel[0].common;
+				channel =  ARINC429_CHANNEL_TX1;
+			}
+			else
+			{
+				common  = &arinc429.rx_channel[message & 1].common;
+				channel =  ARINC429_CHANNEL_RX1 + (message & 1);
+			}
 
-				cb_heartbeat.channel          =  ARINC429_CHANNEL_TX1;
-				cb_heartbeat.seq_number       = *seq_number;
-				cb_heartbeat.frames_processed =  arinc429.tx_channel[0].common.frames_processed_curr;
-				cb_heartbeat.frames_lost      =  arinc429.tx_channel[0].common.frames_lost_curr;
+			// get a pointer to the sequence number
+			seq_number = &common->stats_seq_number;
+
+			// extended heartbeat?
+			if(common->stats_format == ARINC429_HEARTBEAT_EXTENDED)
+			{
+				// yes, get the current time
+				uint32_t curr_time = system_timer_get_ms();
+
+				// create the callback message
+				tfp_make_default_header(&cb_heartbeat_ext.header, bootloader_get_uid(), sizeof(ExtendedHeartbeat_Callback), FID_CALLBACK_EXTENDED_HEARTBEAT);
+
+				// collect the callback message data, the time stamp extended to 32 bit (the subtraction is modulo 2^16)
+				cb_heartbeat_ext.channel          =  channel;
+				cb_heartbeat_ext.status           =  ARINC429_STATUS_STATISTICS;
+				cb_heartbeat_ext.seq_number       = *seq_number;
+				cb_heartbeat_ext.timestamp        =  curr_time - (uint16_t)((uint16_t)curr_time - timestamp);
+				cb_heartbeat_ext.frames_processed =  common->frames_processed_curr;
+				cb_heartbeat_ext.frames_lost      =  common->frames_lost_curr;
+				cb_heartbeat_ext.parity_errors    =  common->parity_errors_curr;
+				cb_heartbeat_ext.queue_overflows  =  arinc429.system.queue_overflows;
+				cb_heartbeat_ext.spi_errors       =  arinc429.system.spi_errors;
+
+				// send the callback message
+				bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_heartbeat_ext, sizeof(ExtendedHeartbeat_Callback));
 			}
 			else
 			{
-				seq_number = &arinc429.rx_channel[message & 1].common.stats_seq_number;
+				// no, create the callback message
+				tfp_make_default_header(&cb_heartbeat.header, bootloader_get_uid(), sizeof(Heartbeat_Callback), FID_CALLBACK_HEARTBEAT);
 
-				cb_heartbeat.channel          =  ARINC429_CHANNEL_RX1 + (message & 1);
+				// collect the callback message data, the counters chopped to 16 bit and parity errors counted as lost frames
+				cb_heartbeat.channel          =  channel;
+				cb_heartbeat.status           =  ARINC429_STATUS_STATISTICS;
 				cb_heartbeat.seq_number       = *seq_number;
-				cb_heartbeat.frames_processed =  arinc429.rx_channel[message & 1].common.frames_processed_curr;
-				cb_heartbeat.frames_lost      =  arinc429.rx_channel[message & 1].common.frames_lost_curr;
+				cb_heartbeat.timestamp        =  timestamp;
+				cb_heartbeat.frames_processed =  (uint16_t)(common->frames_processed_curr);
+				cb_heartbeat.frames_lost      =  (uint16_t)(common->frames_lost_curr + common->parity_errors_curr);
+
+				// send the callback message
+				bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_heartbeat, sizeof(Heartbeat_Callback));
 			}
 
 			// increment the sequence number, thereby skipping the value 0
 			if(++(*seq_number) == 0) ++(*seq_number);
 
-			// send the callback message
-			bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_heartbeat, sizeof(Heartbeat_Callback));
-
 			// ARINC429_CALLBACK_JOB_STATS_* done
 			break;
 
@@ -1476,6 +3096,33 @@ bool handle_callbacks(void)
 			break;
 
 
+		case ARINC429_CALLBACK_JOB_OVERFLOW_RX1 :  /* FALLTHROUGH */
+		case ARINC429_CALLBACK_JOB_OVERFLOW_RX2 :
+
+			// create the callback message
+			tfp_make_default_header(&cb_overflow.header, bootloader_get_uid(), sizeof(FIFOOverflow_Callback), FID_CALLBACK_FIFO_OVERFLOW);
+
+			// get a pointer to the sequence number, the overflows are numbered in line with the frame messages
+			seq_number = &arinc429.rx_channel[message & 1].common.frame_seq_number;
+
+			// collect the callback message data
+			cb_overflow.channel    =  ARINC429_CHANNEL_RX1 + (message & 1);
+			cb_overflow.status     =  ARINC429_STATUS_FIFO_OVERFLOW;
+			cb_overflow.seq_number = *seq_number;
+			cb_overflow.timestamp  =  timestamp;
+			cb_overflow.overflows  =  frame;
+
+			// increment the sequence number, thereby skipping the value 0
+			if(++(*seq_number) == 0) ++(*seq_number);
+
+			// send the callback message
+			bootloader_spitfp_send_ack_and_message(&bootloader_status, (uint8_t*)&cb_overflow, sizeof(FIFOOverflow_Callback));
+
+			// ARINC429_CALLBACK_JOB_OVERFLOW_RX* done
+			break;
+
+
+
 		default :
 
 			// erroneous message type - do nothing
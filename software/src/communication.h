@@ -77,6 +77,7 @@ void communication_init(void);
 #define ARINC429_CHANNEL_MODE_PASSIVE      0  // initialized, but inactive (output stage of TX channels in HI-Z)
 #define ARINC429_CHANNEL_MODE_ACTIVE       1  // initialized, ready to receive (RX channels) / ready for direct transmit (TX channels)
 #define ARINC429_CHANNEL_MODE_RUN          2  // TX channels only: active and scheduler running
+#define ARINC429_CHANNEL_MODE_MONITOR      3  // RX channels only: all frames captured into the capture ring, no filtering (filters are kept, but can not be changed)
 
 #define ARINC429_PRIORITY_DISABLED         0  // RX priority buffers disabled
 #define ARINC429_PRIORITY_ENABLED          1  // RX priority buffers enabled
@@ -86,6 +87,8 @@ void communication_init(void);
 #define ARINC429_STATUS_TIMEOUT            2  // frame is overdue (frame data are last data received)
 #define ARINC429_STATUS_SCHEDULER          3  // scheduler message
 #define ARINC429_STATUS_STATISTICS         4  // scheduler message
+#define ARINC429_STATUS_FIFO_OVERFLOW      5  // RX FIFO found full, frames may have been dropped by the A429 chip
+#define ARINC429_STATUS_CREDITS            6  // immediate transmit queue drained down to the watermark
 
 #define ARINC429_SCHEDULER_JOB_SKIP        0  // scheduler job code for for an unused task table entry
 #define ARINC429_SCHEDULER_JOB_CALLBACK    1  // scheduler job code for sending a callback
@@ -101,6 +104,27 @@ void communication_init(void);
 #define ARINC429_TX_MODE_TRANSMIT          0  // transmit the frame / trigger a new single transmit | keep in line with ARINC429_SET   (enable  TX)
 #define ARINC429_TX_MODE_MUTE              1  // do not transmit the frame                          | keep in line with ARINC429_CLEAR (disable TX)
 
+#define ARINC429_TIME_BASE_MS              0  // scheduler dwell times are given in ms and measured with the system timer
+#define ARINC429_TIME_BASE_UNIT_MAX     1000  // max dwell time unit of the fine scheduler time base [us]
+
+#define ARINC429_SCHEDULE_COMMIT           0  // apply the staged job table changes at the end of the current schedule cycle (wrap-around to job 0)
+#define ARINC429_SCHEDULE_DISCARD          1  // drop the staged job table changes
+
+#define ARINC429_STAGING_ACCEPTED          0  // job table change staged
+#define ARINC429_STAGING_BUFFER_FULL       1  // job table change refused, all ARINC429_TX_STAGED_NUM staging entries in use
+#define ARINC429_STAGING_COMMIT_PENDING    2  // job table change refused, the staged changes wait for the end of the schedule cycle
+
+#define ARINC429_HEARTBEAT_STANDARD        0  // heartbeat callback with 16 bit frame counters
+#define ARINC429_HEARTBEAT_EXTENDED        1  // extended heartbeat callback with 32 bit counters and error counters
+
+#define ARINC429_STAGE_CHANNEL_CONFIG      0  // performance counters stage: update of the channel configuration
+#define ARINC429_STAGE_TX_IMMEDIATE        1  // performance counters stage: immediate transmit
+#define ARINC429_STAGE_TX_SCHEDULED        2  // performance counters stage: scheduled transmit
+#define ARINC429_STAGE_RECEIVE_FRAMES      3  // performance counters stage: reception of frames
+#define ARINC429_STAGE_CHECK_TIMEOUT       4  // performance counters stage: check for timeouts
+#define ARINC429_STAGE_HEARTBEAT           5  // performance counters stage: generation of the heartbeats
+#define ARINC429_STAGES_NUM                6  // number of performance counters stages
+
 
 // internal parameters encoding
 
@@ -118,11 +142,24 @@ void communication_init(void);
 #define ARINC429_CALLBACK_JOB_TIMEOUT_RX1  8  // callback job code for a RX timeout    event, bit 0 = 0 -> RX channel 1
 #define ARINC429_CALLBACK_JOB_TIMEOUT_RX2  9  // callback job code for a RX timeout    event, bit 0 = 1 -> RX channel 2
 #define ARINC429_CALLBACK_JOB_SCHEDULER_CB 10 // callback job code for a TX scheduler  event
+#define ARINC429_CALLBACK_JOB_OVERFLOW_RX1 12 // callback job code for a RX FIFO overflow event, bit 0 = 0 -> RX channel 1
+#define ARINC429_CALLBACK_JOB_OVERFLOW_RX2 13 // callback job code for a RX FIFO overflow event, bit 0 = 1 -> RX channel 2
 
 #define ARINC429_CALLBACK_OFF              0  // callback disabled
 #define ARINC429_CALLBACK_ON               1  // callback enabled
 #define ARINC429_CALLBACK_ON_CHANGE        2  // callback enabled, on change only
 
+#define ARINC429_CALLBACK_BATCH_OFF        0  // frame callbacks are sent one by one
+#define ARINC429_CALLBACK_BATCH_ON         1  // frame callbacks are sent as frame batches
+#define ARINC429_CALLBACK_BATCH_SIZE       8  // max number of frames in a frame batch callback (limited by the TFP message size)
+#define ARINC429_CALLBACK_BATCH_LATENCY  100  // max hold-back time of frames in a frame batch callback [ms]
+
+#define ARINC429_CAPTURE_CHUNK_SIZE        6  // number of captured frames per read_capture_low_level() response (limited by the TFP message size)
+#define ARINC429_TABLE_CHUNK_SIZE          6  // number of frame table entries per read_frame_table_low_level() response (limited by the TFP message size)
+#define ARINC429_STATS_CHUNK_SIZE          4  // number of statistics entries per read_rx_statistics_low_level() response (limited by the TFP message size)
+#define ARINC429_WRITE_CHUNK_SIZE         14  // max number of frames per write_frames_direct() request (limited by the 64 byte TFP payload: 2 + 14 * 4 = 58 byte)
+#define ARINC429_HISTOGRAM_SIZE           16  // number of buckets of the frame age histogram, equals ARINC429_RX_HISTOGRAM_NUM
+
 
 // system parameter encodings
 
@@ -172,6 +209,38 @@ void communication_init(void);
 #define FID_RESTART                                  23
 #define FID_CALLBACK_SCHEDULER_MESSAGE               24
 #define FID_SET_FRAME_MODE                           25
+#define FID_SET_RX_PRIORITY_CONFIGURATION            26
+#define FID_GET_RX_PRIORITY_CONFIGURATION            27
+#define FID_SET_RX_FILTER_TIMEOUT                    28
+#define FID_GET_RX_FILTER_TIMEOUT                    29
+#define FID_SET_RX_BATCH_CONFIGURATION               30
+#define FID_GET_RX_BATCH_CONFIGURATION               31
+#define FID_CALLBACK_FRAME_BATCH_MESSAGE             32
+#define FID_SET_RX_BATCH_COALESCING                  33
+#define FID_GET_RX_BATCH_COALESCING                  34
+#define FID_READ_CAPTURE_LOW_LEVEL                   35
+#define FID_READ_FRAME_TABLE_LOW_LEVEL               36
+#define FID_READ_FRAME_DELTA_LOW_LEVEL               37
+#define FID_SET_RX_FILTER_STATISTICS                 38
+#define FID_READ_RX_STATISTICS_LOW_LEVEL             39
+#define FID_GET_RX_FILTER_HISTOGRAM                  40
+#define FID_SET_HEARTBEAT_FORMAT                     41
+#define FID_GET_HEARTBEAT_FORMAT                     42
+#define FID_CALLBACK_EXTENDED_HEARTBEAT              43
+#define FID_GET_PERFORMANCE_COUNTERS                 44
+#define FID_SET_RX_OVERFLOW_CONFIGURATION            45
+#define FID_GET_RX_OVERFLOW_CONFIGURATION            46
+#define FID_GET_RX_FIFO_OVERFLOWS                    47
+#define FID_CALLBACK_FIFO_OVERFLOW                   48
+#define FID_SET_SCHEDULE_TIME_BASE                   49
+#define FID_GET_SCHEDULE_TIME_BASE                   50
+#define FID_WRITE_FRAMES_DIRECT                      51
+#define FID_SET_TX_CREDIT_CONFIGURATION              52
+#define FID_GET_TX_CREDIT_CONFIGURATION              53
+#define FID_CALLBACK_TX_CREDITS                      54
+#define FID_STAGE_SCHEDULE_ENTRY                     55
+#define FID_COMMIT_SCHEDULE                          56
+#define FID_GET_SCHEDULE_COMMIT_STATUS               57
 
 
 /****************************************************************************/
@@ -218,6 +287,26 @@ typedef struct {
 } __attribute__((__packed__)) GetHeartbeatCallbackConfiguration_Response;
 
 
+// set_heartbeat_format()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           format;                 // ARINC429_HEARTBEAT_STANDARD / _EXTENDED
+} __attribute__((__packed__)) SetHeartbeatFormat;
+
+
+// get_heartbeat_format()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetHeartbeatFormat;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           format;                 // ARINC429_HEARTBEAT_STANDARD / _EXTENDED
+} __attribute__((__packed__)) GetHeartbeatFormat_Response;
+
+
 // set_channel_configuration()
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -332,6 +421,177 @@ typedef struct {
 } __attribute__((__packed__)) ReadFrame_Response;
 
 
+// read_frame_table_low_level()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) ReadFrameTableLowLevel;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint16_t          entries_length;         // number of frame table entries in the stream
+	uint16_t          entries_chunk_offset;   // position of this chunk in the stream
+	uint16_t          ext_label_chunk_data[ARINC429_TABLE_CHUNK_SIZE];  // bits 10-8: SDI (ARINC429_SDI0 .. _SDI_DATA), bits 7-0: label
+	uint8_t           status_chunk_data   [ARINC429_TABLE_CHUNK_SIZE];  // frame available (1) or not (0)
+	uint32_t          frame_chunk_data    [ARINC429_TABLE_CHUNK_SIZE];  // frame data in case status == 1
+	uint16_t          age_chunk_data      [ARINC429_TABLE_CHUNK_SIZE];  // frame age [ms]
+} __attribute__((__packed__)) ReadFrameTableLowLevel_Response;
+
+
+// read_frame_delta_low_level()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) ReadFrameDeltaLowLevel;
+
+typedef ReadFrameTableLowLevel_Response ReadFrameDeltaLowLevel_Response;  // same as for read_frame_table_low_level()
+
+
+// read_capture_low_level()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint16_t          length;                 // max number of captured frames to read
+} __attribute__((__packed__)) ReadCaptureLowLevel;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint16_t          frames_length;          // number of captured frames in the stream
+	uint16_t          frames_chunk_offset;    // position of this chunk in the stream
+	uint32_t          frame_chunk_data    [ARINC429_CAPTURE_CHUNK_SIZE];  // frames
+	uint32_t          timestamp_chunk_data[ARINC429_CAPTURE_CHUNK_SIZE];  // time of arrival [ms]
+	uint8_t           channel_chunk_data  [ARINC429_CAPTURE_CHUNK_SIZE];  // RX channel (ARINC429_CHANNEL_RX1, _RX2)
+} __attribute__((__packed__)) ReadCaptureLowLevel_Response;
+
+
+// set_rx_filter_timeout()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           label;                  // label code
+	uint8_t           sdi;                    // use of SDI bits
+	uint16_t          timeout;                // timeout setting [ms], 0 = use the channel timeout, else 10 - 60000 with 1 ms resolution
+} __attribute__((__packed__)) SetRXFilterTimeout;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              success;                // filter exists and the period fits in (max. ARINC429_RX_TIMEOUTS_NUM distinct per-filter periods per channel)
+} __attribute__((__packed__)) SetRXFilterTimeout_Response;
+
+
+// get_rx_filter_timeout()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           label;                  // label code
+	uint8_t           sdi;                    // use of SDI bits
+} __attribute__((__packed__)) GetRXFilterTimeout;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              configured;             // filter exists
+	uint16_t          timeout;                // timeout in effect for the filter [ms]
+} __attribute__((__packed__)) GetRXFilterTimeout_Response;
+
+
+// set_rx_filter_statistics()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           label;                  // label code
+	uint8_t           sdi;                    // use of SDI bits
+	bool              enabled;                // receive statistics enabled (and reset) / disabled
+} __attribute__((__packed__)) SetRXFilterStatistics;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              success;                // filter exists and statistics available
+} __attribute__((__packed__)) SetRXFilterStatistics_Response;
+
+
+// read_rx_statistics_low_level()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) ReadRXStatisticsLowLevel;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint16_t          entries_length;         // number of statistics entries in the stream
+	uint16_t          entries_chunk_offset;   // position of this chunk in the stream
+	uint16_t          ext_label_chunk_data    [ARINC429_STATS_CHUNK_SIZE];  // bits 10-8: SDI (ARINC429_SDI0 .. _SDI_DATA), bits 7-0: label
+	uint32_t          frames_chunk_data       [ARINC429_STATS_CHUNK_SIZE];  // number of frames received
+	uint16_t          interval_min_chunk_data [ARINC429_STATS_CHUNK_SIZE];  // shortest interval between two frames [ms]
+	uint16_t          interval_max_chunk_data [ARINC429_STATS_CHUNK_SIZE];  // longest  interval between two frames [ms]
+	uint16_t          interval_mean_chunk_data[ARINC429_STATS_CHUNK_SIZE];  // mean     interval between two frames [ms]
+	uint16_t          timeouts_chunk_data     [ARINC429_STATS_CHUNK_SIZE];  // number of timeouts
+} __attribute__((__packed__)) ReadRXStatisticsLowLevel_Response;
+
+
+// get_rx_filter_histogram()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           label;                  // label code
+	uint8_t           sdi;                    // use of SDI bits
+} __attribute__((__packed__)) GetRXFilterHistogram;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              success;                // filter exists and has statistics enabled
+	uint16_t          bucket[ARINC429_HISTOGRAM_SIZE];  // number of intervals per bucket: 0 ms, 1 ms, 2-3 ms, 4-7 ms, ... >= 16384 ms
+} __attribute__((__packed__)) GetRXFilterHistogram_Response;
+
+
+// get_performance_counters()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+} __attribute__((__packed__)) GetPerformanceCounters;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint32_t          loop_rate;              // main loop passes in the last second
+	uint16_t          stage_avg[ARINC429_STAGES_NUM];  // mean time per pass in the last second of each stage of the A429 task [us]
+	uint16_t          stage_max[ARINC429_STAGES_NUM];  // longest time in one pass of each stage of the A429 task [us], saturating at 65535
+	uint16_t          callback_high_water;    // max fill level of the callback queue
+	uint8_t           tx_queue_high_water;    // max fill level of the immediate transmit queue
+	uint32_t          budget_exhausted[2];    // RX frame budget used up with frames still pending in the FIFO, [0] = RX1, [1] = RX2
+	uint32_t          spi_transactions;       // number of SPI transactions with the A429 chip
+} __attribute__((__packed__)) GetPerformanceCounters_Response;
+
+
+// set_rx_overflow_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	bool              enabled;                // callback enabled / disabled
+} __attribute__((__packed__)) SetRXOverflowConfiguration;
+
+
+// get_rx_overflow_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetRXOverflowConfiguration;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              enabled;                // callback enabled / disabled
+} __attribute__((__packed__)) GetRXOverflowConfiguration_Response;
+
+
+// get_rx_fifo_overflows()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetRXFIFOOverflows;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint32_t          overflows;              // number of times the RX FIFO was found full
+	bool              fifo_full;              // RX FIFO was full at the last check
+} __attribute__((__packed__)) GetRXFIFOOverflows_Response;
+
+
 // set_rx_callback_configuration()
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -364,6 +624,43 @@ typedef struct {
 } __attribute__((__packed__)) WriteFrameDirect;
 
 
+// write_frames_direct()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           frames_length;          // number of valid entries in the array below
+	uint32_t          frame[ARINC429_WRITE_CHUNK_SIZE];  // complete A429 frames (data and label), sent in this order
+} __attribute__((__packed__)) WriteFramesDirect;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           frames_accepted;        // number of leading frames taken into the immediate transmit queue, the others are to be sent again
+	uint8_t           credits;                // number of frames the immediate transmit queue can take now
+} __attribute__((__packed__)) WriteFramesDirect_Response;
+
+
+// set_tx_credit_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	bool              enabled;                // callback enabled / disabled
+	uint8_t           watermark;              // callback when the queue fill level drops to this number of frames
+} __attribute__((__packed__)) SetTXCreditConfiguration;
+
+
+// get_tx_credit_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel: ARINC429_CHANNEL_TX1
+} __attribute__((__packed__)) GetTXCreditConfiguration;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              enabled;                // callback enabled / disabled
+	uint8_t           watermark;              // callback when the queue fill level drops to this number of frames
+} __attribute__((__packed__)) GetTXCreditConfiguration_Response;
+
+
 // write_frame_scheduled()
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -380,7 +677,7 @@ typedef struct {
 	uint16_t          job_index;              // index number in job table
 	uint8_t           job;                    // assigned job
 	uint16_t          frame_index;            // index number in frame table selecting frame to send
-	uint8_t           dwell_time;             // time in ms to wait before executing the next job
+	uint8_t           dwell_time;             // time in ms (or in units of the fine time base) to wait before executing the next job
 } __attribute__((__packed__)) SetScheduleEntry;
 
 
@@ -405,10 +702,67 @@ typedef struct {
 	uint8_t           job;                    // assigned job
 	uint16_t          frame_index;            // index number in frame table selecting frame to send
 	uint32_t          frame;                  // complete A429 frame sent (data and label)
-	uint8_t           dwell_time;             // time in ms waited before executing the next job
+	uint8_t           dwell_time;             // time in ms (or in units of the fine time base) waited before executing the next job
 } __attribute__((__packed__)) GetScheduleEntry_Response;
 
 
+// set_schedule_time_base()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint16_t          dwell_unit;             // ARINC429_TIME_BASE_MS or dwell time unit in us (1 .. ARINC429_TIME_BASE_UNIT_MAX)
+} __attribute__((__packed__)) SetScheduleTimeBase;
+
+
+// get_schedule_time_base()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel: ARINC429_CHANNEL_TX1
+} __attribute__((__packed__)) GetScheduleTimeBase;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint16_t          dwell_unit;             // ARINC429_TIME_BASE_MS or dwell time unit in us
+} __attribute__((__packed__)) GetScheduleTimeBase_Response;
+
+
+// stage_schedule_entry()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint16_t          job_index;              // index number in job table
+	uint8_t           job;                    // assigned job
+	uint16_t          frame_index;            // index number in frame table selecting frame to send
+	uint8_t           dwell_time;             // time in ms (or in units of the fine time base) to wait before executing the next job
+} __attribute__((__packed__)) StageScheduleEntry;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           status;                 // ARINC429_STAGING_ACCEPTED, _BUFFER_FULL, _COMMIT_PENDING
+} __attribute__((__packed__)) StageScheduleEntry_Response;
+
+
+// commit_schedule()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           action;                 // ARINC429_SCHEDULE_COMMIT / _DISCARD
+} __attribute__((__packed__)) CommitSchedule;
+
+
+// get_schedule_commit_status()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel: ARINC429_CHANNEL_TX1
+} __attribute__((__packed__)) GetScheduleCommitStatus;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           entries_staged;         // number of staged job table changes
+	bool              commit_pending;         // staged changes wait for the end of the schedule cycle
+} __attribute__((__packed__)) GetScheduleCommitStatus_Response;
+
+
 // restart()
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -424,6 +778,70 @@ typedef struct {
 } __attribute__((__packed__)) SetFrameMode;
 
 
+// set_rx_priority_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           mode;                   // priority label mail boxes enabled / disabled
+	uint8_t           label[3];               // labels assigned to the mail boxes #1 to #3, use duplicates for less than 3 labels
+} __attribute__((__packed__)) SetRXPriorityConfiguration;
+
+
+// get_rx_priority_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetRXPriorityConfiguration;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           mode;                   // priority label mail boxes enabled / disabled
+	uint8_t           label[3];               // labels assigned to the mail boxes #1 to #3
+} __attribute__((__packed__)) GetRXPriorityConfiguration_Response;
+
+
+// set_rx_batch_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	bool              enabled;                // frame batch callback enabled / disabled
+} __attribute__((__packed__)) SetRXBatchConfiguration;
+
+
+// get_rx_batch_configuration()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetRXBatchConfiguration;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	bool              enabled;                // frame batch callback enabled / disabled
+} __attribute__((__packed__)) GetRXBatchConfiguration_Response;
+
+
+// set_rx_batch_coalescing()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+	uint8_t           min_frames;             // frames are held back until this number of frames is queued...
+	uint8_t           max_latency;            // ...or the oldest frame is held back for this time [ms]
+} __attribute__((__packed__)) SetRXBatchCoalescing;
+
+
+// get_rx_batch_coalescing()
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // selected channel
+} __attribute__((__packed__)) GetRXBatchCoalescing;
+
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           min_frames;             // frames are held back until this number of frames is queued...
+	uint8_t           max_latency;            // ...or the oldest frame is held back for this time [ms]
+} __attribute__((__packed__)) GetRXBatchCoalescing_Response;
+
+
 /*** output data structures - callbacks ***/
 
 // bricklet heartbeat callback
@@ -438,6 +856,21 @@ typedef struct {
 } __attribute__((__packed__)) Heartbeat_Callback;
 
 
+// bricklet extended heartbeat callback
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // channel this heartbeat is valid for
+	uint8_t           status;                 // reason for the callback: ARINC429_STATUS_STATISTICS
+	uint8_t           seq_number;             // sequence number of the heartbeat message
+	uint32_t          timestamp;              // time of message creation
+	uint32_t          frames_processed;       // statistics counter - processed frames
+	uint32_t          frames_lost;            // statistics counter - lost      frames
+	uint32_t          parity_errors;          // statistics counter - frames received with parity error (RX channels only)
+	uint32_t          queue_overflows;        // statistics counter - messages lost for a full callback queue (all channels)
+	uint32_t          spi_errors;             // statistics counter - failed SPI transactions with the A429 chip (all channels)
+} __attribute__((__packed__)) ExtendedHeartbeat_Callback;
+
+
 // frame message callback
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -450,6 +883,18 @@ typedef struct {
 } __attribute__((__packed__)) Frame_Callback;
 
 
+// frame batch message callback
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           seq_number;             // sequence number of the frame batch message
+	uint16_t          timestamp;              // time of message creation of the first frame
+	uint8_t           frames_num;             // number of valid entries in the arrays below
+	uint8_t           channel_status[ARINC429_CALLBACK_BATCH_SIZE]; // bits 7-4: RX channel (0 = RX1, 1 = RX2), bits 3-0: ARINC429_STATUS_NEW, _UPDATE, _TIMEOUT
+	uint32_t          frame[ARINC429_CALLBACK_BATCH_SIZE];          // complete A429 frames received (data and label)
+	uint16_t          age[ARINC429_CALLBACK_BATCH_SIZE];            // time elapsed since last reception of a frame with this label and SDI, in [ms]
+} __attribute__((__packed__)) Frame_Batch_Callback;
+
+
 // scheduler message callback
 typedef struct {
 	TFPMessageHeader  header;                 // message header
@@ -461,14 +906,37 @@ typedef struct {
 } __attribute__((__packed__)) Scheduler_Callback;
 
 
+// RX FIFO overflow callback
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // channel on which the overflow was detected
+	uint8_t           status;                 // reason for the callback: ARINC429_STATUS_FIFO_OVERFLOW
+	uint8_t           seq_number;             // sequence number of the rx callback message (shared with the frame message callback)
+	uint16_t          timestamp;              // time of message creation
+	uint32_t          overflows;              // number of times the RX FIFO was found full, including this one
+} __attribute__((__packed__)) FIFOOverflow_Callback;
+
+
+// TX queue credits callback
+typedef struct {
+	TFPMessageHeader  header;                 // message header
+	uint8_t           channel;                // channel whose immediate transmit queue has drained
+	uint8_t           status;                 // reason for the callback: ARINC429_STATUS_CREDITS
+	uint8_t           seq_number;             // sequence number of the tx callback message (shared with the scheduler message callback)
+	uint16_t          timestamp;              // time of message creation
+	uint8_t           credits;                // number of frames the immediate transmit queue can take
+} __attribute__((__packed__)) TXCredits_Callback;
+
+
 /****************************************************************************/
 /* PROTOTYPES                                                               */
 /****************************************************************************/
 
 /*** function prototypes - internal functions ***/
 
-bool check_sw_filter_map(uint8_t channel_index, uint16_t ext_label);
-bool enqueue_message    (uint8_t message_type,  uint16_t timestamp, uint32_t frame, uint16_t age_token);
+bool check_rx_capture_active(uint8_t channel_index);
+bool check_sw_filter_map    (uint8_t channel_index, uint16_t ext_label);
+bool enqueue_message        (uint8_t message_type,  uint16_t timestamp, uint32_t frame, uint16_t age_token);
 
 
 /*** function prototypes - API ***/
@@ -477,6 +945,8 @@ BootloaderHandleMessageResponse get_capabilities                    (const GetCa
 
 BootloaderHandleMessageResponse set_heartbeat_callback_configuration(const SetHeartbeatCallbackConfiguration *data                                                      );
 BootloaderHandleMessageResponse get_heartbeat_callback_configuration(const GetHeartbeatCallbackConfiguration *data, GetHeartbeatCallbackConfiguration_Response *response);
+BootloaderHandleMessageResponse set_heartbeat_format                (const SetHeartbeatFormat                *data                                                      );
+BootloaderHandleMessageResponse get_heartbeat_format                (const GetHeartbeatFormat                *data, GetHeartbeatFormat_Response                *response);
 
 BootloaderHandleMessageResponse set_channel_configuration           (const SetChannelConfiguration           *data                                                      );
 BootloaderHandleMessageResponse get_channel_configuration           (const GetChannelConfiguration           *data, GetChannelConfiguration_Response           *response);
@@ -490,22 +960,53 @@ BootloaderHandleMessageResponse set_rx_standard_filters             (const SetRX
 BootloaderHandleMessageResponse set_rx_filter                       (const SetRXFilter                       *data, SetRXFilter_Response                       *response);
 BootloaderHandleMessageResponse get_rx_filter                       (const GetRXFilter                       *data, GetRXFilter_Response                       *response);
 
+BootloaderHandleMessageResponse set_rx_filter_timeout               (const SetRXFilterTimeout                *data, SetRXFilterTimeout_Response                *response);
+BootloaderHandleMessageResponse get_rx_filter_timeout               (const GetRXFilterTimeout                *data, GetRXFilterTimeout_Response                *response);
+
+BootloaderHandleMessageResponse set_rx_filter_statistics            (const SetRXFilterStatistics             *data, SetRXFilterStatistics_Response             *response);
+BootloaderHandleMessageResponse read_rx_statistics_low_level        (const ReadRXStatisticsLowLevel          *data, ReadRXStatisticsLowLevel_Response          *response);
+BootloaderHandleMessageResponse get_rx_filter_histogram             (const GetRXFilterHistogram              *data, GetRXFilterHistogram_Response              *response);
+
+BootloaderHandleMessageResponse get_performance_counters            (const GetPerformanceCounters            *data, GetPerformanceCounters_Response            *response);
+
+BootloaderHandleMessageResponse set_rx_overflow_configuration       (const SetRXOverflowConfiguration        *data                                                      );
+BootloaderHandleMessageResponse get_rx_overflow_configuration       (const GetRXOverflowConfiguration        *data, GetRXOverflowConfiguration_Response        *response);
+BootloaderHandleMessageResponse get_rx_fifo_overflows               (const GetRXFIFOOverflows                *data, GetRXFIFOOverflows_Response                *response);
+
 BootloaderHandleMessageResponse read_frame                          (const ReadFrame                         *data, ReadFrame_Response                         *response);
+BootloaderHandleMessageResponse read_frame_table_low_level          (const ReadFrameTableLowLevel            *data, ReadFrameTableLowLevel_Response            *response);
+BootloaderHandleMessageResponse read_frame_delta_low_level          (const ReadFrameDeltaLowLevel            *data, ReadFrameDeltaLowLevel_Response            *response);
+BootloaderHandleMessageResponse read_capture_low_level              (const ReadCaptureLowLevel               *data, ReadCaptureLowLevel_Response               *response);
 
 BootloaderHandleMessageResponse set_rx_callback_configuration       (const SetRXCallbackConfiguration        *data                                                      );
 BootloaderHandleMessageResponse get_rx_callback_configuration       (const GetRXCallbackConfiguration        *data, GetRXCallbackConfiguration_Response        *response);
+BootloaderHandleMessageResponse set_rx_batch_configuration          (const SetRXBatchConfiguration           *data                                                      );
+BootloaderHandleMessageResponse get_rx_batch_configuration          (const GetRXBatchConfiguration           *data, GetRXBatchConfiguration_Response           *response);
+BootloaderHandleMessageResponse set_rx_batch_coalescing             (const SetRXBatchCoalescing              *data                                                      );
+BootloaderHandleMessageResponse get_rx_batch_coalescing             (const GetRXBatchCoalescing              *data, GetRXBatchCoalescing_Response              *response);
 
 BootloaderHandleMessageResponse write_frame_direct                  (const WriteFrameDirect                  *data                                                      );
+BootloaderHandleMessageResponse write_frames_direct                 (const WriteFramesDirect                 *data, WriteFramesDirect_Response                 *response);
+BootloaderHandleMessageResponse set_tx_credit_configuration         (const SetTXCreditConfiguration          *data                                                      );
+BootloaderHandleMessageResponse get_tx_credit_configuration         (const GetTXCreditConfiguration          *data, GetTXCreditConfiguration_Response          *response);
 BootloaderHandleMessageResponse write_frame_scheduled               (const WriteFrameScheduled               *data                                                      );
 
 BootloaderHandleMessageResponse clear_schedule_entries              (const ClearScheduleEntries              *data                                                      );
 BootloaderHandleMessageResponse set_schedule_entry                  (const SetScheduleEntry                  *data                                                      );
 BootloaderHandleMessageResponse get_schedule_entry                  (const GetScheduleEntry                  *data, GetScheduleEntry_Response                  *response);
+BootloaderHandleMessageResponse set_schedule_time_base              (const SetScheduleTimeBase               *data                                                      );
+BootloaderHandleMessageResponse get_schedule_time_base              (const GetScheduleTimeBase               *data, GetScheduleTimeBase_Response               *response);
+BootloaderHandleMessageResponse stage_schedule_entry                (const StageScheduleEntry                *data, StageScheduleEntry_Response                *response);
+BootloaderHandleMessageResponse commit_schedule                     (const CommitSchedule                    *data                                                      );
+BootloaderHandleMessageResponse get_schedule_commit_status          (const GetScheduleCommitStatus           *data, GetScheduleCommitStatus_Response           *response);
 
 BootloaderHandleMessageResponse restart                             (const Restart                           *data                                                      );
 
 BootloaderHandleMessageResponse set_frame_mode                      (const SetFrameMode                      *data                                                      );
 
+BootloaderHandleMessageResponse set_rx_priority_configuration       (const SetRXPriorityConfiguration        *data                                                      );
+BootloaderHandleMessageResponse get_rx_priority_configuration       (const GetRXPriorityConfiguration        *data, GetRXPriorityConfiguration_Response        *response);
+
 
 /*** function prototypes - callbacks ***/
 
@@ -106,6 +106,27 @@
 #define HI3593_R1FLAG_PIN             9
 #define HI3593_R1FLAG_INDEX           9
 
+// R1INT / R2INT interrupts via the event request unit, rising edge = frame stored in the FIFO or a mail box
+#define HI3593_R1INT_ERU              XMC_ERU0
+#define HI3593_R1INT_ERU_ETL          2                             // event trigger logic channel
+#define HI3593_R1INT_ERU_OGU          2                             // output gating unit  channel
+#define HI3593_R1INT_ERU_INPUT        XMC_ERU_ETL_INPUT_B1          // ERU0.2B1 = P2.8
+#define HI3593_R1INT_ERU_SOURCE       XMC_ERU_ETL_SOURCE_B
+#define HI3593_R1INT_IRQ_N            5                             // ERU0.SR2
+#define HI3593_R1INT_IRQ_CTRL         XMC_SCU_IRQCTRL_ERU0_SR2_IRQ5
+#define HI3593_R1INT_IRQ_PRIO         0
+#define HI3593_R1INT_IRQ_HANDLER      IRQ_Hdlr_5
+
+#define HI3593_R2INT_ERU              XMC_ERU0
+#define HI3593_R2INT_ERU_ETL          3                             // event trigger logic channel
+#define HI3593_R2INT_ERU_OGU          3                             // output gating unit  channel
+#define HI3593_R2INT_ERU_INPUT        XMC_ERU_ETL_INPUT_B1          // ERU0.3B1 = P2.6
+#define HI3593_R2INT_ERU_SOURCE       XMC_ERU_ETL_SOURCE_B
+#define HI3593_R2INT_IRQ_N            6                             // ERU0.SR3
+#define HI3593_R2INT_IRQ_CTRL         XMC_SCU_IRQCTRL_ERU0_SR3_IRQ6
+#define HI3593_R2INT_IRQ_PRIO         0
+#define HI3593_R2INT_IRQ_HANDLER      IRQ_Hdlr_6
+
 #define HI3593_TEMPTY_PORT            XMC_GPIO_PORT2
 #define HI3593_TEMPTY_PIN             10
 #define HI3593_TEMPTY_INDEX           10
@@ -22,12 +22,16 @@
 #include "hi3593.h"
 
 #include "bricklib2/hal/ccu4_pwm/ccu4_pwm.h"
+#include "bricklib2/hal/system_timer/system_timer.h"
 #include "bricklib2/utility/util_definitions.h"
 #include "bricklib2/os/coop_task.h"
 #include "bricklib2/logging/logging.h"
 
 #include "opcode_length.inc"
 
+#include "xmc_eru.h"
+#include "xmc_scu.h"
+
 
 /****************************************************************************/
 /* data structures                                                          */
@@ -112,10 +116,106 @@ static void hi3593_init_spi(void)
 }
 
 
+/* RX1 frame received: R1INT interrupt */
+void __attribute__((optimize("-O3"))) __attribute__ ((section (".ram_code"))) HI3593_R1INT_IRQ_HANDLER(void)
+{
+	hi3593_rx_int(0);
+}
+
+
+/* RX2 frame received: R2INT interrupt */
+void __attribute__((optimize("-O3"))) __attribute__ ((section (".ram_code"))) HI3593_R2INT_IRQ_HANDLER(void)
+{
+	hi3593_rx_int(1);
+}
+
+
+/* R1INT / R2INT interrupt initialization */
+static void hi3593_init_rx_int(void)
+{
+	// event on the rising edge of the RxINT pulse
+	XMC_ERU_ETL_CONFIG_t etl_config =
+	{
+		.enable_output_trigger = true,
+		.status_flag_mode      = XMC_ERU_ETL_STATUS_FLAG_MODE_HWCTRL,
+		.edge_detection        = XMC_ERU_ETL_EDGE_DETECTION_RISING,
+	};
+
+	// service request on every event
+	const XMC_ERU_OGU_CONFIG_t ogu_config =
+	{
+		.service_request = XMC_ERU_OGU_SERVICE_REQUEST_ON_TRIGGER
+	};
+
+	// R1INT
+	etl_config.input_b                = HI3593_R1INT_ERU_INPUT;
+	etl_config.source                 = HI3593_R1INT_ERU_SOURCE;
+	etl_config.output_trigger_channel = HI3593_R1INT_ERU_OGU;
+
+	XMC_ERU_ETL_Init(HI3593_R1INT_ERU, HI3593_R1INT_ERU_ETL, &etl_config);
+	XMC_ERU_OGU_Init(HI3593_R1INT_ERU, HI3593_R1INT_ERU_OGU, &ogu_config);
+
+	XMC_SCU_SetInterruptControl(HI3593_R1INT_IRQ_N, HI3593_R1INT_IRQ_CTRL);
+	NVIC_SetPriority(HI3593_R1INT_IRQ_N, HI3593_R1INT_IRQ_PRIO);
+	NVIC_EnableIRQ(HI3593_R1INT_IRQ_N);
+
+	// R2INT
+	etl_config.input_b                = HI3593_R2INT_ERU_INPUT;
+	etl_config.source                 = HI3593_R2INT_ERU_SOURCE;
+	etl_config.output_trigger_channel = HI3593_R2INT_ERU_OGU;
+
+	XMC_ERU_ETL_Init(HI3593_R2INT_ERU, HI3593_R2INT_ERU_ETL, &etl_config);
+	XMC_ERU_OGU_Init(HI3593_R2INT_ERU, HI3593_R2INT_ERU_OGU, &ogu_config);
+
+	XMC_SCU_SetInterruptControl(HI3593_R2INT_IRQ_N, HI3593_R2INT_IRQ_CTRL);
+	NVIC_SetPriority(HI3593_R2INT_IRQ_N, HI3593_R2INT_IRQ_PRIO);
+	NVIC_EnableIRQ(HI3593_R2INT_IRQ_N);
+
+	return;
+}
+
+
 /****************************************************************************/
 /* global functions                                                         */
 /****************************************************************************/
 
+/* record the arrival time of a frame, called by the RxINT interrupts
+ *
+ * The A429 chip pulses RxINT for each frame it stores in the RX FIFO or in a
+ * priority mail box. A frame that fills a mail box raises its MBx full discrete
+ * along with the pulse, so it gets its arrival time recorded per mail box. The
+ * time stamps of the FIFO frames queue up in the same order as the frames in
+ * the FIFO, the task consumes them while reading the FIFO.
+ */
+void hi3593_rx_int(const uint8_t channel)
+{
+	const uint16_t time = (uint16_t)(system_timer_get_ms() & 0x0000FFFF);
+
+	// has the frame filled a mail box? (a frame overwriting an unread mail box can not be told apart from a FIFO frame)
+	for(uint8_t k = 0; k < 3; k++)
+	{
+		if(hi3593.rx_mailbox_full[channel][k])  continue;
+
+		if(XMC_GPIO_GetInput(hi3593_input_ports[HI3593_MB11_INDEX + 3*channel + k], hi3593_input_pins[HI3593_MB11_INDEX + 3*channel + k]))
+		{
+			// yes, record the arrival time for the mail box
+			hi3593.rx_mailbox_time[channel][k] = time;
+			hi3593.rx_mailbox_full[channel][k] = true;
+
+			return;
+		}
+	}
+
+	// no, the frame went into the FIFO
+	const uint8_t head = hi3593.rx_arrival_head[channel];
+
+	hi3593.rx_arrival_time[channel][head & (HI3593_RX_ARRIVAL_QUEUE_SIZE - 1)] = time;
+
+	// publish the time stamp
+	hi3593.rx_arrival_head[channel] = head + 1;
+}
+
+
 /* initialize driver data structure */
 void hi3593_init_data(void)
 {
@@ -166,6 +266,9 @@ void hi3593_init_chip(void)
 	hi3593.led_flicker_state_rx.config = LED_FLICKER_CONFIG_STATUS;
 	hi3593.led_flicker_state_tx.config = LED_FLICKER_CONFIG_STATUS;
 
+	// start recording the RX frame arrival times
+	hi3593_init_rx_int();
+
 	// done
 	return;
 }
@@ -183,6 +286,9 @@ uint32_t hi3593_write_register(const uint8_t opcode, const uint8_t *data, const
 	// execute SPI transfer
 	const bool ret = spi_fifo_coop_transceive(&hi3593.spi_fifo, length+1, opcode_and_data, opcode_and_data);
 
+	// count the transfer
+	hi3593.spi_transactions++;
+
 	// done
 	return ret ? 0 : 1;
 }
@@ -197,6 +303,9 @@ uint32_t hi3593_read_register(const uint8_t opcode, uint8_t *data, const uint8_t
 	// execute SPI transfer
 	const bool ret = spi_fifo_coop_transceive(&hi3593.spi_fifo, length+1, opcode_and_data, opcode_and_data);
 
+	// count the transfer
+	hi3593.spi_transactions++;
+
 	// copy data from buffer to output
 	memcpy(data, opcode_and_data+1, length);
 
@@ -205,6 +314,94 @@ uint32_t hi3593_read_register(const uint8_t opcode, uint8_t *data, const uint8_t
 }
 
 
+/* read several frames from a RX FIFO
+ *
+ * The HI-3593 does not accept a chain of instructions within one chip select
+ * window, so each frame is fetched by its own SPI transaction. The transfers
+ * are issued back-to-back without polling the RxFLAG discrete in between, the
+ * caller has to ensure that the FIFO holds at least 'frames_num' frames.
+ */
+uint32_t hi3593_read_fifo(const uint8_t opcode, uint8_t *data, const uint8_t frames_num)
+{
+	uint32_t errors = 0;
+
+	for(uint8_t i = 0; i < frames_num; i++)
+	{
+		// create buffer and load opcode
+		uint8_t opcode_and_data[5] = {(1 << 7) | opcode};	// 1 byte opcode + 4 byte frame
+
+		// execute SPI transfer
+		if(!spi_fifo_coop_transceive(&hi3593.spi_fifo, 5, opcode_and_data, opcode_and_data))  errors++;
+
+		// count the transfer
+		hi3593.spi_transactions++;
+
+		// copy frame from buffer to output
+		memcpy(data + 4*i, opcode_and_data+1, 4);
+	}
+
+	// done
+	return errors;
+}
+
+
+/* write several frames into the TX FIFO
+ *
+ * As with hi3593_read_fifo(), each frame needs its own SPI transaction. The
+ * transfers are issued back-to-back without polling the TFULL discrete in
+ * between, the caller has to ensure that the FIFO has room for 'frames_num'
+ * frames. The frames are expected with the highest byte first.
+ */
+uint32_t hi3593_write_fifo(const uint8_t opcode, const uint8_t *data, const uint8_t frames_num)
+{
+	uint32_t errors = 0;
+
+	for(uint8_t i = 0; i < frames_num; i++)
+	{
+		// create buffer, load opcode and frame
+		uint8_t opcode_and_data[5] = {opcode, data[4*i], data[4*i+1], data[4*i+2], data[4*i+3]};
+
+		// execute SPI transfer
+		if(!spi_fifo_coop_transceive(&hi3593.spi_fifo, 5, opcode_and_data, opcode_and_data))  errors++;
+
+		// count the transfer
+		hi3593.spi_transactions++;
+	}
+
+	// done
+	return errors;
+}
+
+
+/* get a free-running count of CPU clock cycles (wraps around), derived from the SysTick timer */
+uint32_t hi3593_get_cycles(void)
+{
+	uint32_t ms;
+	uint32_t count;
+	bool     pending;
+
+	// read the SysTick counter together with the millisecond count, repeat if a millisecond has passed in between
+	do
+	{
+		ms      = system_timer_get_ms();
+		count   = SysTick->VAL;
+
+		// has the counter been reloaded with its interrupt still pending, e.g. held off by a higher-priority interrupt?
+		pending = (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+
+		// yes, re-read the counter to be sure to get a value from after the reload
+		if(pending)  count = SysTick->VAL;
+	}
+	while(ms != system_timer_get_ms());
+
+	// the millisecond count of a pending reload is not yet accounted for
+	if(pending)  ms++;
+
+	// the SysTick counter counts down from LOAD to 0 once per millisecond
+	return ms * (SysTick->LOAD + 1) + (SysTick->LOAD - count);
+}
+
+
 /****************************************************************************/
 /* task & tick functions                                                    */
 /****************************************************************************/
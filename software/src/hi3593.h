@@ -34,14 +34,26 @@
 /* DATA STRUCTURES                                                          */
 /****************************************************************************/
 
+#define HI3593_RX_ARRIVAL_QUEUE_SIZE  32    // number of arrival time stamps per RX channel, = RX FIFO depth ** given by hardware, power of 2 **
+
 typedef struct
 {
+	// RX frame arrival times, recorded by the R1INT / R2INT interrupts in the order the frames enter the RX FIFOs
+	volatile uint16_t rx_arrival_time[2][HI3593_RX_ARRIVAL_QUEUE_SIZE];   // arrival time [ms] (ring buffer)
+	volatile uint8_t  rx_arrival_head[2];                                 // number of recorded frames, modulo 256 - written by the interrupts only
+	         uint8_t  rx_arrival_tail[2];                                 // number of consumed frames, modulo 256 - written by the task only
+
+	// RX mail box arrival times, recorded by the R1INT / R2INT interrupts instead of a FIFO time stamp when the frame filled a mail box
+	volatile uint16_t rx_mailbox_time[2][3];                              // arrival time [ms] of the frame in mail box #1 - #3
+	volatile bool     rx_mailbox_full[2][3];                              // mail box known to be full - set by the interrupts, cleared by the task
+
 	// RX / TX LEDs
 	LEDFlickerState led_flicker_state_rx;
 	LEDFlickerState led_flicker_state_tx;
 
 	// SPI bus with A429 chip
 	SPIFifo spi_fifo;
+	uint32_t spi_transactions;                                            // number of SPI transactions, for the performance counters
 }
 HI3593;
 
@@ -60,6 +72,10 @@ void     hi3593_init_data     (void);
 void     hi3593_init_chip     (void);
 uint32_t hi3593_write_register(const uint8_t opcode, const uint8_t *data, const uint8_t length);
 uint32_t hi3593_read_register (const uint8_t opcode,       uint8_t *data, const uint8_t length);
+uint32_t hi3593_read_fifo     (const uint8_t opcode,       uint8_t *data, const uint8_t frames_num);
+uint32_t hi3593_write_fifo    (const uint8_t opcode, const uint8_t *data, const uint8_t frames_num);
+void     hi3593_rx_int        (const uint8_t channel);
+uint32_t hi3593_get_cycles    (void);
 
 
 /****************************************************************************/
@@ -74,11 +90,13 @@ uint32_t hi3593_read_register (const uint8_t opcode,       uint8_t *data, const
 #define HI3593_CMD_WRITE_ACLK_DIV   0x38    // clock divider setup
 
 // TX channel
+#define HI3593_CMD_READ_TX1_STATUS  0x80    // status   register - read
 #define HI3593_CMD_WRITE_TX1_CTRL   0x08    // general  control  - write
 #define HI3593_CMD_READ_TX1_CTRL    0x84    // general  control  - read
 #define HI3593_CMD_WRITE_TX1_FIFO   0x0C    // transmit buffer
 
 // RX1 channel
+#define HI3593_CMD_READ_RX1_STATUS  0x90    // status   register - read
 #define HI3593_CMD_WRITE_RX1_CTRL   0x10    // general  control - write
 #define HI3593_CMD_READ_RX1_CTRL    0x94    // general  control - read
 #define HI3593_CMD_WRITE_RX1_PRIO   0x18    // priority control - write
@@ -90,6 +108,7 @@ uint32_t hi3593_read_register (const uint8_t opcode,       uint8_t *data, const
 #define HI3593_CMD_READ_RX1_PRIO3   0xAC    // prio3 buffer
 
 // RX2 channel
+#define HI3593_CMD_READ_RX2_STATUS  0xB0    // status   register - read
 #define HI3593_CMD_WRITE_RX2_CTRL   0x24    // general  control - write
 #define HI3593_CMD_READ_RX2_CTRL    0xB4    // general  control - read
 #define HI3593_CMD_WRITE_RX2_PRIO   0x2C    // priority control - write
@@ -100,6 +119,14 @@ uint32_t hi3593_read_register (const uint8_t opcode,       uint8_t *data, const
 #define HI3593_CMD_READ_RX2_PRIO2   0xC8    // prio2 buffer
 #define HI3593_CMD_READ_RX2_PRIO3   0xCC    // prio3 buffer
 
+// RX status register bits
+#define HI3593_RX_STATUS_FFFULL     (1 << 2)    // FIFO holds 32 frames
+#define HI3593_RX_STATUS_FFHALF     (1 << 1)    // FIFO holds at least 16 frames
+#define HI3593_RX_STATUS_FFEMPTY    (1 << 0)    // FIFO is empty
+
+// CPU clock
+#define HI3593_CYCLES_PER_US        48          // CPU clock cycles per us, i.e. count rate of hi3593_get_cycles() (XMC1400 at 48 MHz)
+
 
 #endif  // HI3593_H
 